@@ -0,0 +1,154 @@
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/DynamicAABBTree.hpp"
+#include "geometry/RectArray.hpp"
+#include "geometry/SpatialHashGrid.hpp"
+#include "geometry/SweepAndPrune.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * Rects of size 1 to 2 spread over a square that grows with their number, so the number of
+     * overlapping pairs stays proportional to the number of rects.
+     */
+    std::vector<geometry::Rect> makeWorld(std::size_t count)
+    {
+        const float side = 4.0f * std::sqrt(static_cast<float>(count));
+        std::mt19937 generator(4);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        std::uniform_real_distribution<float> size(1.0f, 2.0f);
+        std::vector<geometry::Rect> rects;
+        rects.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            rects.emplace_back(coordinate(generator), coordinate(generator), size(generator), size(generator));
+        }
+        return rects;
+    }
+
+    geometry::Rect makeQuery(std::size_t count)
+    {
+        const float side = 4.0f * std::sqrt(static_cast<float>(count));
+        return geometry::Rect(side / 2.0f, side / 2.0f, 10.0f, 10.0f);
+    }
+}
+
+static void BM_CheckerQueryOverlaps(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const geometry::RectArray rects(makeWorld(count));
+    const geometry::Rect query = makeQuery(count);
+    std::vector<std::uint32_t> hits;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(geometry::CollisionChecker::queryOverlaps(query, rects, hits));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckerQueryOverlaps)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_GridFindPairs(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<geometry::Rect> rects = makeWorld(count);
+    geometry::SpatialHashGrid grid(4.0f, count);
+    for (std::size_t i = 0; i < rects.size(); i++)
+    {
+        grid.insert(rects[i], static_cast<std::uint32_t>(i));
+    }
+
+    std::vector<geometry::IndexPair> pairs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(grid.findPairs(pairs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GridFindPairs)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_TreeBuild(benchmark::State& state)
+{
+    const std::vector<geometry::Rect> rects = makeWorld(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        geometry::DynamicAABBTree tree;
+        for (std::size_t i = 0; i < rects.size(); i++)
+        {
+            tree.insert(rects[i], static_cast<std::uint32_t>(i));
+        }
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TreeBuild)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_TreeQuery(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<geometry::Rect> rects = makeWorld(count);
+    geometry::DynamicAABBTree tree;
+    for (std::size_t i = 0; i < rects.size(); i++)
+    {
+        tree.insert(rects[i], static_cast<std::uint32_t>(i));
+    }
+
+    const geometry::Rect query = makeQuery(count);
+    std::vector<std::uint32_t> hits;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.query(query, hits));
+    }
+}
+BENCHMARK(BM_TreeQuery)->RangeMultiplier(10)->Range(10, 1000000);
+
+static void BM_TreeFindPairs(benchmark::State& state)
+{
+    const std::vector<geometry::Rect> rects = makeWorld(static_cast<std::size_t>(state.range(0)));
+    geometry::DynamicAABBTree tree;
+    for (std::size_t i = 0; i < rects.size(); i++)
+    {
+        tree.insert(rects[i], static_cast<std::uint32_t>(i));
+    }
+
+    std::vector<geometry::IndexPair> pairs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.findPairs(pairs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TreeFindPairs)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SweepAndPruneUpdate(benchmark::State& state)
+{
+    const std::vector<geometry::Rect> rects = makeWorld(static_cast<std::size_t>(state.range(0)));
+    geometry::SweepAndPrune sweep;
+    std::vector<geometry::SweepAndPrune::ProxyId> proxies;
+    for (std::size_t i = 0; i < rects.size(); i++)
+    {
+        proxies.push_back(sweep.insert(rects[i], static_cast<std::uint32_t>(i)));
+    }
+
+    // The first update adds every proxy in one batch, it is kept out of the timing
+    std::vector<geometry::IndexPair> added;
+    std::vector<geometry::IndexPair> removed;
+    sweep.updatePairs(added, removed);
+
+    // Every object then jitters back and forth, the frame to frame coherence the sweep relies on
+    float offset = 0.1f;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < rects.size(); i++)
+        {
+            geometry::Rect moved = rects[i];
+            moved.moveWith(geometry::Vector2(offset, -offset));
+            sweep.update(proxies[i], moved);
+        }
+        sweep.updatePairs(added, removed);
+        offset = -offset;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SweepAndPruneUpdate)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,89 @@
+#include "geometry/Polygon.hpp"
+#include "geometry/Triangulator.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * A star shaped polygon with random radii.
+     */
+    geometry::Polygon makePolygon(std::size_t count)
+    {
+        std::mt19937 generator(3);
+        std::uniform_real_distribution<float> radius(5.0f, 10.0f);
+        auto vertexAt = [&](std::size_t i) {
+            const float angle = 2.0f * 3.14159265f * i / count;
+            const float r = radius(generator);
+            return geometry::Vector2(r * std::cos(angle), r * std::sin(angle));
+        };
+
+        geometry::Polygon polygon(vertexAt(0), vertexAt(1), vertexAt(2));
+        for (std::size_t i = 3; i < count; i++)
+        {
+            polygon.addVertex(vertexAt(i));
+        }
+        return polygon;
+    }
+}
+
+// The area, perimeter, bounds and centroid are kept up to date as vertices are added and moved, so
+// reading them should not depend on the number of vertices
+
+static void BM_PolygonCenter(benchmark::State& state)
+{
+    const geometry::Polygon polygon = makePolygon(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(polygon.center());
+    }
+}
+BENCHMARK(BM_PolygonCenter)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_PolygonMetrics(benchmark::State& state)
+{
+    const geometry::Polygon polygon = makePolygon(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(polygon.area());
+        benchmark::DoNotOptimize(polygon.perimeter());
+        benchmark::DoNotOptimize(polygon.bounds());
+    }
+}
+BENCHMARK(BM_PolygonMetrics)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_PolygonBuild(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(makePolygon(count));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PolygonBuild)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_PolygonMoveWith(benchmark::State& state)
+{
+    geometry::Polygon polygon = makePolygon(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        polygon.moveWith(geometry::Vector2(0.25f, -0.25f));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PolygonMoveWith)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_PolygonTriangulate(benchmark::State& state)
+{
+    const geometry::Polygon polygon = makePolygon(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> indices;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(polygon.triangulate(indices));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PolygonTriangulate)->RangeMultiplier(8)->Range(8, 1 << 15);
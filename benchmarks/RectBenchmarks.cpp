@@ -0,0 +1,72 @@
+#include "geometry/Rect.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<geometry::Rect> makeRects(std::size_t count)
+    {
+        std::mt19937 generator(2);
+        std::uniform_real_distribution<float> coordinate(0.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.5f, 5.0f);
+        std::vector<geometry::Rect> rects;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            rects.emplace_back(coordinate(generator), coordinate(generator), size(generator), size(generator));
+        }
+        return rects;
+    }
+
+    constexpr std::size_t RECT_COUNT = 1024;
+}
+
+static void BM_RectOverlaps(benchmark::State& state)
+{
+    const std::vector<geometry::Rect> rects = makeRects(RECT_COUNT);
+    for (auto _ : state)
+    {
+        std::size_t overlaps = 0;
+        for (std::size_t i = 0; i + 1 < rects.size(); i++)
+        {
+            overlaps += rects[i].overlaps(rects[i + 1]);
+        }
+        benchmark::DoNotOptimize(overlaps);
+    }
+    state.SetItemsProcessed(state.iterations() * (RECT_COUNT - 1));
+}
+BENCHMARK(BM_RectOverlaps);
+
+static void BM_RectMetrics(benchmark::State& state)
+{
+    const std::vector<geometry::Rect> rects = makeRects(RECT_COUNT);
+    for (auto _ : state)
+    {
+        double sum = 0.0;
+        for (const auto& rect : rects)
+        {
+            const geometry::Vector2 center = rect.center();
+            sum += rect.area() + rect.perimeter() + center.x + center.y;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * RECT_COUNT);
+}
+BENCHMARK(BM_RectMetrics);
+
+static void BM_RectTransforms(benchmark::State& state)
+{
+    std::vector<geometry::Rect> rects = makeRects(RECT_COUNT);
+    for (auto _ : state)
+    {
+        for (auto& rect : rects)
+        {
+            rect.moveWith(geometry::Vector2(0.5f, -0.5f));
+            rect.scaleWith(1.0f);
+            rect.rotate90DegreesClockwise();
+        }
+        benchmark::DoNotOptimize(rects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * RECT_COUNT);
+}
+BENCHMARK(BM_RectTransforms);
@@ -0,0 +1,132 @@
+#include "geometry/CachedVector2.hpp"
+#include "geometry/Vector2.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<geometry::Vector2> makeVectors(std::size_t count)
+    {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+        std::vector<geometry::Vector2> vectors;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            vectors.emplace_back(coordinate(generator), coordinate(generator));
+        }
+        return vectors;
+    }
+
+    constexpr std::size_t VECTOR_COUNT = 1024;
+}
+
+// Arithmetic followed by repeated reads of the lenght, without and with the memo cache
+
+static void BM_Vector2Arithmetic(benchmark::State& state)
+{
+    const std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (std::size_t i = 0; i + 1 < vectors.size(); i++)
+        {
+            geometry::Vector2 vector = vectors[i];
+            vector.add(vectors[i + 1]).scaleBy(0.5f);
+            for (int read = 0; read < static_cast<int>(state.range(0)); read++)
+            {
+                sum += vector.lenght();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (VECTOR_COUNT - 1));
+}
+BENCHMARK(BM_Vector2Arithmetic)->Arg(1)->Arg(8);
+
+static void BM_CachedVector2Arithmetic(benchmark::State& state)
+{
+    const std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (std::size_t i = 0; i + 1 < vectors.size(); i++)
+        {
+            geometry::CachedVector2 vector(vectors[i]);
+            vector.add(vectors[i + 1]).scaleBy(0.5f);
+            for (int read = 0; read < static_cast<int>(state.range(0)); read++)
+            {
+                sum += vector.lenght();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (VECTOR_COUNT - 1));
+}
+BENCHMARK(BM_CachedVector2Arithmetic)->Arg(1)->Arg(8);
+
+static void BM_Vector2Lenght(benchmark::State& state)
+{
+    const std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (const auto& vector : vectors)
+        {
+            sum += vector.lenght();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VECTOR_COUNT);
+}
+BENCHMARK(BM_Vector2Lenght);
+
+static void BM_Vector2Normalize(benchmark::State& state)
+{
+    const std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    std::vector<geometry::Vector2> work(vectors.size());
+    for (auto _ : state)
+    {
+        work = vectors;
+        for (auto& vector : work)
+        {
+            vector.normalize();
+        }
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VECTOR_COUNT);
+}
+BENCHMARK(BM_Vector2Normalize);
+
+static void BM_Vector2RotateBy(benchmark::State& state)
+{
+    std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    for (auto _ : state)
+    {
+        for (auto& vector : vectors)
+        {
+            vector.rotateBy(0.01f);
+        }
+        benchmark::DoNotOptimize(vectors.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VECTOR_COUNT);
+}
+BENCHMARK(BM_Vector2RotateBy);
+
+static void BM_CachedVector2RotateBy(benchmark::State& state)
+{
+    const std::vector<geometry::Vector2> vectors = makeVectors(VECTOR_COUNT);
+    std::vector<geometry::CachedVector2> cached(vectors.begin(), vectors.end());
+    for (auto _ : state)
+    {
+        for (auto& vector : cached)
+        {
+            vector.rotateBy(0.01f);
+        }
+        benchmark::DoNotOptimize(cached.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VECTOR_COUNT);
+}
+BENCHMARK(BM_CachedVector2RotateBy);
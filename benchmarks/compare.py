@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Compares a Google Benchmark JSON report against a baseline one.
+
+Usage: compare.py <baseline.json> <current.json> [threshold]
+
+Exits with 1 when a benchmark got slower than the baseline by more than the
+threshold, 0.10 (10%) by default. Benchmarks found in only one report are listed
+but do not fail the comparison.
+"""
+
+import json
+import sys
+
+
+def load(path):
+    with open(path) as report:
+        benchmarks = json.load(report)["benchmarks"]
+    times = {}
+    for benchmark in benchmarks:
+        name = benchmark.get("run_name", benchmark["name"])
+        # With repetitions the mean replaces the single runs
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "mean":
+                times[name] = benchmark["real_time"]
+        elif name not in times or benchmark.get("repetitions", 1) == 1:
+            times[name] = benchmark["real_time"]
+    return times
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit(__doc__)
+
+    baseline = load(sys.argv[1])
+    current = load(sys.argv[2])
+    threshold = float(sys.argv[3]) if len(sys.argv) == 4 else 0.10
+
+    regressions = 0
+    for name, time in current.items():
+        if name not in baseline:
+            print(f"{name:<50} new")
+            continue
+        change = time / baseline[name] - 1.0
+        regressed = change > threshold
+        regressions += regressed
+        print(f"{name:<50} {change:+8.1%}{'  REGRESSION' if regressed else ''}")
+    for name in baseline.keys() - current.keys():
+        print(f"{name:<50} missing")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than the baseline by more than {threshold:.0%}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,263 @@
+/**
+ * @file Affine2.hpp
+ * 
+ * @brief A file that contains a 2x3 matrix type for composing and applying 2D affine transforms.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class Rect;
+    class Polygon;
+    class Vector2Array;
+
+    struct Affine2 final {
+
+        // ==============================
+        //      Public members
+        // ==============================
+    public:
+        /**
+         * The matrix
+         *      | a  b  tx |
+         *      | c  d  ty |
+         * which maps a point (x, y) to (a * x + b * y + tx, c * x + d * y + ty).
+         */
+        float a, b, tx;
+        float c, d, ty;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @brief Constructs the identity transform.
+         */
+        constexpr Affine2();
+
+        constexpr Affine2(float a, float b, float tx, float c, float d, float ty);
+
+        // ==============================
+        //      Factories
+        // ==============================
+    public:
+        static constexpr Affine2 identity();
+        static constexpr Affine2 translation(const Vector2& offset);
+
+        /**
+         * @brief Builds a counterclockwise rotation around the origin.
+         * 
+         * This is the only place the sin and cos of the angle are computed, applying the transform
+         * afterwards is pure multiply-add.
+         * 
+         * @param angleRadians The angle of the rotation, in radians.
+         */
+        static Affine2 rotation(float angleRadians);
+
+        /**
+         * @brief Builds a counterclockwise rotation around @p pivot.
+         */
+        static Affine2 rotation(float angleRadians, const Vector2& pivot);
+
+        static constexpr Affine2 scaling(float factor);
+        static constexpr Affine2 scaling(float factorX, float factorY);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        /**
+         * @brief Composes two transforms.
+         * 
+         * The result applies the current transform first and @p next afterwards.
+         * 
+         * @param next The transform applied after the current one.
+         * 
+         * @returns The composed transform as a new @c Affine2 object.
+         */
+        constexpr Affine2 then(const Affine2& next) const;
+
+        constexpr float determinant() const;
+
+        /**
+         * @brief Returns the transform that undoes the current one.
+         * 
+         * @throws std::runtime_error if the transform is singular (determinant close to 0).
+         */
+        Affine2 inverse() const;
+
+        /**
+         * @brief Transforms a point, the translation part is applied.
+         */
+        constexpr Vector2 apply(const Vector2& point) const;
+
+        /**
+         * @brief Transforms a direction, the translation part is ignored.
+         */
+        constexpr Vector2 applyToDirection(const Vector2& direction) const;
+
+        /**
+         * @brief Transforms @p count points stored contiguously, in place, in a single vectorized pass.
+         * 
+         * @param points The first point of the range.
+         * @param count The number of points in the range.
+         */
+        void apply(Vector2* points, std::size_t count) const;
+        void apply(std::vector<Vector2>& points) const;
+
+        /**
+         * @brief Transforms every vector of a structure-of-arrays container in place.
+         */
+        void apply(Vector2Array& points) const;
+
+        /**
+         * @brief Transforms every vertex of @p polygon in place.
+         */
+        void apply(Polygon& polygon) const;
+
+        /**
+         * @brief Computes the exact axis-aligned bounding box of a transformed rect.
+         * 
+         * The box is computed from the rect extents directly, without transforming its four corners.
+         * 
+         * @param rect The rect to transform.
+         * 
+         * @returns The smallest @c Rect containing the transformed rect.
+         */
+        Rect apply(const Rect& rect) const;
+
+        // Object modifier methods
+
+        /**
+         * @brief Appends a translation, applied after the transforms already composed.
+         * 
+         * @returns Affine2& A reference to the current object.
+         */
+        constexpr Affine2& translate(const Vector2& offset);
+
+        /**
+         * @brief Appends a counterclockwise rotation around the origin.
+         * 
+         * @returns Affine2& A reference to the current object.
+         */
+        Affine2& rotate(float angleRadians);
+
+        /**
+         * @brief Appends a uniform scaling around the origin.
+         * 
+         * @returns Affine2& A reference to the current object.
+         */
+        constexpr Affine2& scale(float factor);
+        constexpr Affine2& scale(float factorX, float factorY);
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        /**
+         * @brief Composes two transforms in matrix order, @p other is applied first.
+         * 
+         * @c (A * B).apply(p) is the same as @c A.apply(B.apply(p)).
+         */
+        constexpr Affine2 operator *(const Affine2& other) const;
+    };
+
+    // ==============================
+    //      Inline definitions
+    // ==============================
+
+    constexpr Affine2::Affine2()
+        : a(1.0f), b(0.0f), tx(0.0f), c(0.0f), d(1.0f), ty(0.0f)
+    {
+
+    }
+
+    constexpr Affine2::Affine2(float a, float b, float tx, float c, float d, float ty)
+        : a(a), b(b), tx(tx), c(c), d(d), ty(ty)
+    {
+
+    }
+
+    constexpr Affine2 Affine2::identity()
+    {
+        return Affine2();
+    }
+
+    constexpr Affine2 Affine2::translation(const Vector2& offset)
+    {
+        return Affine2(1.0f, 0.0f, offset.x, 0.0f, 1.0f, offset.y);
+    }
+
+    constexpr Affine2 Affine2::scaling(float factor)
+    {
+        return scaling(factor, factor);
+    }
+
+    constexpr Affine2 Affine2::scaling(float factorX, float factorY)
+    {
+        return Affine2(factorX, 0.0f, 0.0f, 0.0f, factorY, 0.0f);
+    }
+
+    constexpr Affine2 Affine2::then(const Affine2& next) const
+    {
+        return next * (*this);
+    }
+
+    constexpr float Affine2::determinant() const
+    {
+        return a * d - b * c;
+    }
+
+    constexpr Vector2 Affine2::apply(const Vector2& point) const
+    {
+        return Vector2(a * point.x + b * point.y + tx, c * point.x + d * point.y + ty);
+    }
+
+    constexpr Vector2 Affine2::applyToDirection(const Vector2& direction) const
+    {
+        return Vector2(a * direction.x + b * direction.y, c * direction.x + d * direction.y);
+    }
+
+    constexpr Affine2& Affine2::translate(const Vector2& offset)
+    {
+        tx += offset.x;
+        ty += offset.y;
+
+        return *this;
+    }
+
+    constexpr Affine2& Affine2::scale(float factor)
+    {
+        return scale(factor, factor);
+    }
+
+    constexpr Affine2& Affine2::scale(float factorX, float factorY)
+    {
+        a *= factorX;
+        b *= factorX;
+        tx *= factorX;
+        c *= factorY;
+        d *= factorY;
+        ty *= factorY;
+
+        return *this;
+    }
+
+    constexpr Affine2 Affine2::operator *(const Affine2& other) const
+    {
+        return Affine2(
+            a * other.a + b * other.c, a * other.b + b * other.d, a * other.tx + b * other.ty + tx,
+            c * other.a + d * other.c, c * other.b + d * other.d, c * other.tx + d * other.ty + ty
+        );
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file AnyShape.hpp
+ * 
+ * @brief A file that contains a closed set of shapes dispatched without virtual calls.
+ * 
+ * @c AnyShape holds any concrete shape by value, and the functions below pick the implementation
+ * with a switch on the held type instead of going through the @c Shape and @c Movable vtables.
+ * Inside the visitors the calls are qualified with the concrete type, so they are direct calls.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <variant>
+
+#include "geometry/Circle.hpp"
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Triangle.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    using AnyShape = std::variant<Rect, Polygon, Triangle, Circle>;
+
+    double area(const AnyShape& shape);
+    double perimeter(const AnyShape& shape);
+    Vector2 center(const AnyShape& shape);
+    Rect bounds(const AnyShape& shape);
+
+    void moveTo(AnyShape& shape, const Vector2& newPos);
+    void moveWith(AnyShape& shape, const Vector2& changePos);
+
+    // ==============================
+    //      Inline definitions
+    // ==============================
+
+    inline double area(const AnyShape& shape)
+    {
+        return std::visit([](const auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            return concrete.Concrete::area();
+        }, shape);
+    }
+
+    inline double perimeter(const AnyShape& shape)
+    {
+        return std::visit([](const auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            return concrete.Concrete::perimeter();
+        }, shape);
+    }
+
+    inline Vector2 center(const AnyShape& shape)
+    {
+        return std::visit([](const auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            return concrete.Concrete::center();
+        }, shape);
+    }
+
+    inline Rect bounds(const AnyShape& shape)
+    {
+        return std::visit([](const auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            return concrete.Concrete::bounds();
+        }, shape);
+    }
+
+    inline void moveTo(AnyShape& shape, const Vector2& newPos)
+    {
+        std::visit([&newPos](auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            concrete.Concrete::moveTo(newPos);
+        }, shape);
+    }
+
+    inline void moveWith(AnyShape& shape, const Vector2& changePos)
+    {
+        std::visit([&changePos](auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            concrete.Concrete::moveWith(changePos);
+        }, shape);
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file CachedVector2.hpp
+ * 
+ * @brief A file that contains a @c Vector2 wrapper that memoizes its lenght and direction.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class CachedVector2 final {
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @brief Constructs a cached vector from a plain @c Vector2.
+         * 
+         * Nothing is computed up front, the cache is filled on the first query.
+         * 
+         * @param vector The wrapped vector.
+         */
+        CachedVector2(const Vector2& vector = Vector2());
+
+        CachedVector2(float x, float y);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        /**
+         * @brief Returns the wrapped plain vector.
+         */
+        const Vector2& vector() const;
+
+        /**
+         * @brief Returns the magnitude of the vector, computing it only on the first call.
+         * 
+         * @returns The magnitude of the vector as a float.
+         */
+        float lenght() const;
+
+        /**
+         * @brief Returns the sin of the angle between the vector and OX, computing it only on the first call.
+         * 
+         * @throws std::runtime_error() if the vector is (0, 0)
+         */
+        float sinTheta() const;
+
+        /**
+         * @brief Returns the cos of the angle between the vector and OX, computing it only on the first call.
+         * 
+         * @throws std::runtime_error() if the vector is (0, 0)
+         */
+        float cosTheta() const;
+
+        // Object modifier methods
+
+        /**
+         * @brief Replaces the wrapped vector and invalidates the cache.
+         * 
+         * @returns CachedVector2& A refference to the current object.
+         */
+        CachedVector2& moveTo(const Vector2& vector);
+        CachedVector2& moveTo(const float x, const float y);
+
+        CachedVector2& normalize();
+        CachedVector2& rotateBy(float angleRadians);
+        CachedVector2& scaleBy(float scalar);
+        CachedVector2& add(const Vector2& other);
+        CachedVector2& subtract(const Vector2& other);
+
+        /**
+         * @brief Computes the cache fields that are not memoized.
+         * 
+         * @returns CachedVector2& A refference to the current object.
+         * 
+         * @throws std::runtime_error() if the vector is (0, 0)
+         */
+        CachedVector2& precompute();
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        operator const Vector2&() const;
+
+        // ==============================
+        //      Private members
+        // ==============================
+    private:
+        Vector2 value;
+
+        struct Cache {
+            using OptionalFloat = std::optional<float>;
+            mutable OptionalFloat lenght;
+            mutable OptionalFloat sinTheta;
+            mutable OptionalFloat cosTheta;
+
+            Cache& invalidate()
+            {
+                lenght.reset();
+                sinTheta.reset();
+                cosTheta.reset();
+                return *this;
+            }
+        } mutable cache;
+    };
+}
@@ -0,0 +1,77 @@
+/**
+ * @file Circle.hpp
+ * 
+ * @brief This file contains a class representing a circle.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include "geometry/Vector2.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/Movable.hpp"
+
+namespace geometry {
+    class Circle : public Shape, public Movable {
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        /**
+         * @throws std::invalid_argument If @p radius is negative.
+         */
+        Circle(Vector2 center, float radius);
+
+        virtual ~Circle() = default;
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        double area() const override;
+        double perimeter() const override;
+        Vector2 center() const override;
+        Rect bounds() const override;
+        Vector2 support(const Vector2& direction) const override;
+
+        void moveTo(const Vector2& newPos) override;
+        void moveWith(const Vector2& changePos) override;
+
+        /**
+         * @brief Checks if @p point is inside the circle or on its boundary.
+         */
+        bool contains(const Vector2& point) const;
+
+        /**
+         * @brief Checks if the two circles overlap, comparing squared distances so no square root is taken.
+         * Circles that only touch count as overlapping.
+         */
+        bool overlaps(const Circle& other) const;
+
+        /**
+         * @brief Checks if the circle overlaps @p rect, a circle that only touches it counts as overlapping.
+         */
+        bool overlaps(const Rect& rect) const;
+
+        // ==============================
+        //      Getters and setters
+        // ==============================
+    public:
+        float getRadius() const;
+
+        /**
+         * @throws std::invalid_argument If @p radius is negative.
+         */
+        Circle& setRadius(float radius);
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Vector2 position;
+        float radius;
+    };
+}
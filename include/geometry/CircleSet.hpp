@@ -0,0 +1,122 @@
+/**
+ * @file CircleSet.hpp
+ * 
+ * @brief A file that contains a structure-of-arrays container of circles with batch overlap kernels.
+ * 
+ * The centers and radii live in separate aligned buffers, so the kernels stream through them
+ * @c internal::simd::WIDTH circles at a time. Every test compares squared distances and never
+ * takes a square root.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Circle.hpp"
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/internal/AlignedAllocator.hpp"
+#include "geometry/internal/simd.hpp"
+
+namespace geometry {
+    class CircleSet final {
+
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using Buffer = std::vector<float, internal::AlignedAllocator<float, internal::simd::ALIGNMENT>>;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        CircleSet() = default;
+        CircleSet(const std::vector<Circle>& circles);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        std::size_t size() const;
+        bool empty() const;
+        Circle get(std::size_t index) const;
+
+        /**
+         * @brief Finds every circle that overlaps @p circle, touching ones included.
+         * 
+         * @param hits Receives the indices of the circles in increasing order, it is cleared first.
+         * 
+         * @returns The number of circles found.
+         */
+        std::size_t findOverlapping(const Circle& circle, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every circle that overlaps @p rect, touching ones included.
+         * 
+         * @param hits Receives the indices of the circles in increasing order, it is cleared first.
+         * 
+         * @returns The number of circles found.
+         */
+        std::size_t findOverlapping(const Rect& rect, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every circle that contains @p point, boundaries included.
+         * 
+         * @param hits Receives the indices of the circles in increasing order, it is cleared first.
+         * 
+         * @returns The number of circles found.
+         */
+        std::size_t findContaining(const Vector2& point, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every pair of overlapping circles of the set.
+         * 
+         * @param pairs Receives the pairs, ordered by first then second index, it is cleared first.
+         * 
+         * @returns The number of pairs.
+         */
+        std::size_t findOverlappingPairs(std::vector<IndexPair>& pairs) const;
+
+        /**
+         * @brief Finds every pair made of a circle of the set and an overlapping circle of @p other.
+         * 
+         * @param pairs Receives the pairs as (index in this set, index in @p other), it is cleared first.
+         * 
+         * @returns The number of pairs.
+         */
+        std::size_t findOverlappingPairs(const CircleSet& other, std::vector<IndexPair>& pairs) const;
+
+        // Object modifier methods
+
+        void reserve(std::size_t capacity);
+        void clear();
+        void push_back(const Circle& circle);
+        CircleSet& set(std::size_t index, const Circle& circle);
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        /**
+         * @brief Direct access to the buffers, aligned to @c internal::simd::ALIGNMENT.
+         */
+        const float* xData() const;
+        const float* yData() const;
+        const float* radiusData() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Buffer xs, ys;
+        Buffer radii;
+    };
+}
@@ -0,0 +1,211 @@
+/**
+ * @file Clipper.hpp
+ *
+ * @brief A file that contains the clipping of polygons against rectangles and the boolean operations
+ * between polygons.
+ *
+ * A @c Clipper keeps its working buffers between calls and writes into buffers owned by the caller,
+ * so clipping many polygons with the same objects stops allocating once the buffers have grown.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Vector2.hpp"
+#include "geometry/internal/UniformGrid.hpp"
+
+namespace geometry {
+    /**
+     * @brief The boolean operations supported by @c Clipper::compute().
+     */
+    enum class BooleanOperation {
+        Union,
+        Intersection,
+        Difference
+    };
+
+    /**
+     * @brief A set of closed contours stored back to back, the result of a boolean operation.
+     *
+     * Outer boundaries are counter-clockwise and holes are clockwise.
+     */
+    struct Contours {
+        /**
+         * @brief The vertices of every contour, one contour after the other.
+         */
+        std::vector<Vector2> vertices;
+
+        /**
+         * @brief Contour i is made of the vertices in [offsets[i], offsets[i + 1]).
+         */
+        std::vector<std::size_t> offsets;
+
+        /**
+         * @brief Removes every contour, keeping the allocated memory.
+         */
+        void clear();
+
+        /**
+         * @brief Returns the number of contours.
+         */
+        std::size_t size() const;
+
+        const Vector2* contourData(std::size_t contour) const;
+        std::size_t contourSize(std::size_t contour) const;
+
+        /**
+         * @brief Returns the area covered by the contours, holes counting as negative.
+         */
+        double area() const;
+    };
+
+    class Clipper final {
+
+        // ==============================
+        //      Clipping
+        // ==============================
+    public:
+        /**
+         * @brief Clips a polygon against a rectangle, with the Sutherland-Hodgman algorithm.
+         *
+         * The rectangle is convex, so the result is a single contour. Each of the four passes is a
+         * branch-light loop over a contiguous buffer that the compiler can unroll and vectorize.
+         * Parts of a concave polygon that leave the rectangle and come back are joined along its
+         * border by degenerate edges.
+         *
+         * @param output Receives the vertices of the clipped polygon, empty if nothing is left. It is
+         * cleared first.
+         *
+         * @returns The number of vertices in @p output.
+         */
+        std::size_t clip(const Vector2* vertices, std::size_t count, const Rect& rect, std::vector<Vector2>& output);
+
+        /**
+         * @brief Same as above, for the vertices of @p polygon.
+         */
+        std::size_t clip(const Polygon& polygon, const Rect& rect, std::vector<Vector2>& output);
+
+        // ==============================
+        //      Boolean operations
+        // ==============================
+    public:
+        /**
+         * @brief Computes the union, intersection or difference of two simple polygons, given in
+         * either orientation.
+         *
+         * The edges of both polygons are split where they meet, the meeting points being found in a grid
+         * of cells about as large as an edge, so only edges of the same cell are tested against each other.
+         * A piece that starts on the boundary of the other polygon is found inside or outside it from the
+         * directions of the edges meeting there, and the pieces after it keep that location until the next
+         * meeting point. The kept pieces are chained into contours. Edges shared by both polygons are kept
+         * once when the polygons lie on the same side of them.
+         *
+         * @param output Receives the contours of the result, cleared first.
+         *
+         * @returns The number of contours in @p output.
+         */
+        std::size_t compute(BooleanOperation operation, const Vector2* subject, std::size_t subjectCount,
+            const Vector2* clip, std::size_t clipCount, Contours& output);
+
+        /**
+         * @brief Same as above, for the vertices of two polygons.
+         */
+        std::size_t compute(BooleanOperation operation, const Polygon& subject, const Polygon& clip, Contours& output);
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        /**
+         * Where a point lies on the boundary of the other polygon: nowhere, inside edge @c index or on
+         * vertex @c index.
+         */
+        struct Contact {
+            std::uint32_t index;
+            std::uint8_t kind;
+        };
+
+        /**
+         * A point where an edge is cut, at parameter t along it.
+         */
+        struct Split {
+            std::uint32_t edge;
+            double t;
+            Vector2 point;
+            Contact contact;
+        };
+
+        /**
+         * A piece of an edge that does not cross the other polygon, @c contact is where it starts on it.
+         */
+        struct Fragment {
+            Vector2 start;
+            Vector2 end;
+            std::uint32_t edge;
+            Contact contact;
+            std::uint8_t location;
+        };
+
+        struct Side {
+            std::vector<Vector2> vertices;
+            std::vector<Split> splits;
+            std::vector<Contact> contacts;
+            std::vector<Fragment> fragments;
+
+            // 1 for the edges lying along an edge of the other polygon, the only ones that can share a fragment with it
+            std::vector<std::uint8_t> collinear;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<Vector2> scratch;
+
+        Side sides[2];
+
+        // The edges of cell i are cellEdges[cellStarts[i]] to cellEdges[cellStarts[i + 1]], the ones of the
+        // subject first, numbered as they are, then the ones of the clip, numbered after the subject.
+        internal::UniformGrid grid;
+        std::vector<std::size_t> cellStarts;
+        std::vector<std::size_t> cellCursors;
+        std::vector<std::uint32_t> cellEdges;
+        std::vector<std::uint32_t> sharedOrder;
+        std::vector<Fragment> selected;
+        std::vector<std::uint32_t> chainOrder;
+        std::vector<std::uint8_t> used;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void loadSide(std::size_t side, const Vector2* vertices, std::size_t count);
+        void findSplits();
+
+        /**
+         * Records where edge @p first of the subject and edge @p second of the clip touch, if they do and
+         * the first point they share lies in @p cell, so a pair listed in several cells is cut once.
+         */
+        void intersect(std::uint32_t first, std::uint32_t second, std::size_t cell);
+        void addSplit(std::size_t side, std::uint32_t edge, double t, const Vector2& point, Contact contact);
+        void splitEdges(std::size_t side);
+
+        /**
+         * Finds if @p fragment leaves its contact point into the other polygon, from the directions of
+         * the edges meeting there.
+         *
+         * @returns @c INSIDE, @c OUTSIDE or @c UNKNOWN if the fragment runs along the other polygon.
+         */
+        std::uint8_t locate(std::size_t side, const Fragment& fragment) const;
+        void classify(std::size_t side);
+        void chain(Contours& output);
+    };
+}
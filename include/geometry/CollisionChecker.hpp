@@ -0,0 +1,169 @@
+/**
+ * @file CollisionChecker.hpp
+ * 
+ * @brief A file that contains the entry point for the collision queries.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Rect.hpp"
+#include "geometry/RectArray.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/ThreadPool.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    /**
+     * @brief A pair of indices of two overlapping objects, @c first is always smaller than @c second
+     * when both come from the same collection.
+     */
+    struct IndexPair {
+        std::uint32_t first;
+        std::uint32_t second;
+
+        bool operator ==(const IndexPair& other) const
+        {
+            return first == other.first && second == other.second;
+        }
+
+        bool operator !=(const IndexPair& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @brief A pair of intersecting shapes found by the narrowphase.
+     */
+    struct Contact {
+        IndexPair pair;
+        /** @brief Moving the first shape of the pair with this vector separates the shapes. */
+        Vector2 translation;
+    };
+
+    class CollisionChecker final {
+
+        // ==============================
+        //      Batch AABB queries
+        // ==============================
+    public:
+        /**
+         * @brief Finds every rect of @p rects that overlaps @p query.
+         * 
+         * The rects are tested @c internal::simd::WIDTH at a time with vector compares, and the
+         * resulting masks are compacted into a list of indices.
+         * 
+         * @param query The rect tested against the whole collection.
+         * @param rects The collection, in structure-of-arrays layout.
+         * @param hits Receives the indices of the overlapping rects in increasing order, it is cleared first.
+         * 
+         * @returns The number of overlapping rects.
+         */
+        static std::size_t queryOverlaps(const Rect& query, const RectArray& rects, std::vector<std::uint32_t>& hits);
+
+        /**
+         * @brief Finds every pair of overlapping rects inside @p rects.
+         * 
+         * @param rects The collection, in structure-of-arrays layout.
+         * @param pairs Receives the pairs, ordered by first then second index, it is cleared first.
+         * 
+         * @returns The number of overlapping pairs.
+         */
+        static std::size_t findOverlappingPairs(const RectArray& rects, std::vector<IndexPair>& pairs);
+
+        /**
+         * @brief Finds every pair made of a rect from @p first and an overlapping rect from @p second.
+         * 
+         * @param pairs Receives the pairs as (index in @p first, index in @p second), it is cleared first.
+         * 
+         * @returns The number of overlapping pairs.
+         */
+        static std::size_t findOverlappingPairs(const RectArray& first, const RectArray& second, std::vector<IndexPair>& pairs);
+
+        // ==============================
+        //      Parallel narrowphase
+        // ==============================
+    public:
+        /**
+         * @brief Runs a narrowphase test on every candidate pair, spread over the threads of @p pool.
+         * 
+         * The pairs are split into chunks that the workers steal from each other. Each thread appends
+         * its contacts to its own buffer and the buffers are merged once every chunk is done.
+         * 
+         * @param candidates The pairs found by a broadphase.
+         * @param narrowphase Called as narrowphase(pair, translation) from several threads at once, it
+         * returns true and fills the translation when the pair intersects.
+         * @param contacts Receives the intersecting pairs, it is cleared first.
+         * @param pool The threads that run the tests.
+         * @param deterministic When true the contacts keep the order of @p candidates, otherwise their
+         * order depends on the scheduling.
+         * @param grainSize The number of pairs in a chunk.
+         * 
+         * @returns The number of contacts.
+         */
+        template <typename Narrowphase>
+        static std::size_t checkAllParallel(const std::vector<IndexPair>& candidates, Narrowphase&& narrowphase, std::vector<Contact>& contacts,
+            ThreadPool& pool, bool deterministic = false, std::size_t grainSize = 256);
+
+        /**
+         * @brief Runs @c Gjk::penetration() on every candidate pair, the indices of a pair refer to @p shapes.
+         */
+        static std::size_t checkAllParallel(const std::vector<const Shape*>& shapes, const std::vector<IndexPair>& candidates, std::vector<Contact>& contacts,
+            ThreadPool& pool, bool deterministic = false, std::size_t grainSize = 256);
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename Narrowphase>
+    std::size_t CollisionChecker::checkAllParallel(const std::vector<IndexPair>& candidates, Narrowphase&& narrowphase, std::vector<Contact>& contacts,
+        ThreadPool& pool, bool deterministic, std::size_t grainSize)
+    {
+        // Each contact remembers the position of its pair in the candidates, for the deterministic merge.
+        struct Found {
+            std::size_t candidate;
+            Contact contact;
+        };
+        std::vector<std::vector<Found>> buffers(pool.getThreadCount());
+
+        pool.parallelFor(candidates.size(), grainSize, [&](std::size_t begin, std::size_t end, std::size_t slot) {
+            std::vector<Found>& buffer = buffers[slot];
+            for (std::size_t i = begin; i < end; i++)
+            {
+                Vector2 translation;
+                if (narrowphase(candidates[i], translation))
+                {
+                    buffer.push_back({i, {candidates[i], translation}});
+                }
+            }
+        });
+
+        std::vector<Found> merged;
+        for (auto& buffer : buffers)
+        {
+            merged.insert(merged.end(), buffer.begin(), buffer.end());
+        }
+        if (deterministic)
+        {
+            std::sort(merged.begin(), merged.end(), [](const Found& first, const Found& second) { return first.candidate < second.candidate; });
+        }
+
+        contacts.clear();
+        contacts.reserve(merged.size());
+        for (const auto& found : merged)
+        {
+            contacts.push_back(found.contact);
+        }
+
+        return contacts.size();
+    }
+}
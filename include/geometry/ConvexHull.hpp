@@ -0,0 +1,55 @@
+/**
+ * @file ConvexHull.hpp
+ * 
+ * @brief A file that contains the convex hull construction behind @c Polygon::putVerticesInOrder().
+ * 
+ * The hull is built with Andrew's monotone chain. Before sorting, the Akl-Toussaint heuristic
+ * drops every point strictly inside the octagon spanned by the extreme points in x, y, x + y and
+ * x - y, which for most inputs leaves only a small fraction of the points to sort.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/ThreadPool.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class ConvexHull final {
+
+        // ==============================
+        //      Constants
+        // ==============================
+    public:
+        /**
+         * @brief The number of points from which @c compute() splits the work over the thread pool.
+         */
+        static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 20;
+
+        // ==============================
+        //      Hull construction
+        // ==============================
+    public:
+        /**
+         * @brief Computes the convex hull of a set of points.
+         * 
+         * Large inputs are split into chunks whose hulls are built in parallel and then merged with
+         * one more monotone chain pass over the partial hulls.
+         * 
+         * @param points The points, in any order.
+         * @param count The number of points.
+         * @param hull Receives the hull in counter-clockwise order, starting from the point with the smallest
+         * x and then the smallest y. Collinear points on the edges are left out. It is cleared first.
+         * @param pool The threads used for inputs of at least @c PARALLEL_THRESHOLD points, if any.
+         * 
+         * @returns The number of hull vertices.
+         */
+        static std::size_t compute(const Vector2* points, std::size_t count, std::vector<Vector2>& hull, ThreadPool* pool = nullptr);
+        static std::size_t compute(const std::vector<Vector2>& points, std::vector<Vector2>& hull, ThreadPool* pool = nullptr);
+    };
+}
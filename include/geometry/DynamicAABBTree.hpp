@@ -0,0 +1,259 @@
+/**
+ * @file DynamicAABBTree.hpp
+ * 
+ * @brief A file that contains a bounding volume hierarchy broadphase for the @c CollisionChecker.
+ * 
+ * Unlike the @c SpatialHashGrid, the tree adapts to objects of very different sizes. Leaves store
+ * fattened bounds, so an object that moves a little stays inside its leaf and the tree isn't touched.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/Vector2.hpp"
+#include "geometry/internal/Box.hpp"
+
+namespace geometry {
+    /**
+     * @brief A hit reported by @c DynamicAABBTree::raycast().
+     */
+    struct RaycastHit {
+        std::uint32_t userData;
+
+        /**
+         * Where the segment enters the bounds, 0 is the start of the segment and 1 its end.
+         */
+        float fraction;
+    };
+
+    class DynamicAABBTree final {
+
+        // ==============================
+        //      Types and constants
+        // ==============================
+    public:
+        using ProxyId = std::int32_t;
+
+        static constexpr ProxyId NULL_NODE = -1;
+
+        /**
+         * How many times the displacement passed to @c update() is added to the fat bounds,
+         * in the direction of the movement.
+         */
+        static constexpr float DISPLACEMENT_MULTIPLIER = 2.0f;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @brief Constructs an empty tree.
+         * 
+         * @param margin How much the bounds stored in the leaves are enlarged on every side.
+         */
+        explicit DynamicAABBTree(float margin = 0.1f);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        /**
+         * @brief Finds every pair of objects whose bounds overlap.
+         * 
+         * Every pair is reported exactly once, as (smaller user data, larger user data).
+         * 
+         * @param pairs Receives the pairs, it is cleared first.
+         * 
+         * @returns The number of pairs found.
+         */
+        std::size_t findPairs(std::vector<IndexPair>& pairs) const;
+
+        /**
+         * @brief Finds every object whose bounds overlap @p region.
+         * 
+         * @param hits Receives the user data of the objects, it is cleared first.
+         */
+        std::size_t query(const Rect& region, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every object whose bounds contain @p point.
+         * 
+         * @param hits Receives the user data of the objects, it is cleared first.
+         */
+        std::size_t queryPoint(const Vector2& point, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every object whose bounds are crossed by the segment from @p from to @p to.
+         * 
+         * @param hits Receives the hits ordered by the distance from @p from, it is cleared first.
+         * 
+         * @returns The number of hits.
+         */
+        std::size_t raycast(const Vector2& from, const Vector2& to, std::vector<RaycastHit>& hits) const;
+
+        std::size_t size() const;
+
+        /**
+         * @brief Returns the height of the tree, 0 for an empty tree or a single leaf.
+         */
+        int getHeight() const;
+
+        std::uint32_t getUserData(ProxyId proxy) const;
+        Rect getBounds(ProxyId proxy) const;
+        Rect getFatBounds(ProxyId proxy) const;
+
+        /**
+         * @brief Checks the links, heights, bounds and node count of the tree. Meant for tests and debugging.
+         */
+        bool isValid() const;
+
+        // Object modifier methods
+
+        /**
+         * @brief Adds an object to the tree.
+         * 
+         * @param bounds The bounds of the object.
+         * @param userData A value identifying the object, reported back by the queries.
+         * 
+         * @returns The id used to update or remove the object later.
+         */
+        ProxyId insert(const Rect& bounds, std::uint32_t userData);
+        ProxyId insert(const Shape& shape, std::uint32_t userData);
+
+        /**
+         * @brief Removes an object, its node goes back to the pool.
+         * 
+         * @throws std::invalid_argument if @p proxy is not a leaf of the tree.
+         */
+        void remove(ProxyId proxy);
+
+        /**
+         * @brief Stores the new bounds of an object.
+         * 
+         * The leaf is only reinserted when the new bounds leave its fat bounds. The new fat bounds are then
+         * stretched by @p displacement, so an object moving steadily in one direction is reinserted rarely.
+         * 
+         * @param displacement The movement of the object since the last update, if known.
+         * 
+         * @returns true if the leaf was reinserted, false if only the bounds were stored.
+         * 
+         * @throws std::invalid_argument if @p proxy is not a leaf of the tree.
+         */
+        bool update(ProxyId proxy, const Rect& bounds, const Vector2& displacement = Vector2());
+
+        /**
+         * @brief Moves a shape with @c Movable::moveTo() and updates its leaf.
+         */
+        template <typename MovableShape>
+        bool moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos);
+
+        /**
+         * @brief Moves a shape with @c Movable::moveWith() and updates its leaf, the change is used as displacement.
+         */
+        template <typename MovableShape>
+        bool moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos);
+
+        /**
+         * @brief Removes every object, the node pool keeps its memory.
+         */
+        void clear();
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Node {
+            internal::Box fatBounds;
+
+            /**
+             * The exact bounds of the object, only meaningful for leaves.
+             */
+            internal::Box bounds;
+
+            /**
+             * The parent for nodes in the tree, the next free node for nodes in the free list.
+             */
+            std::int32_t parent;
+            std::int32_t child1;
+            std::int32_t child2;
+
+            /**
+             * 0 for leaves, -1 for free nodes.
+             */
+            std::int32_t height;
+            std::uint32_t userData;
+
+            bool isLeaf() const
+            {
+                return child1 == NULL_NODE;
+            }
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<Node> nodes;
+        std::int32_t root = NULL_NODE;
+        std::int32_t freeList = NULL_NODE;
+        std::size_t leafCount = 0;
+        float margin;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        std::int32_t allocateNode();
+        void freeNode(std::int32_t node);
+
+        void insertLeaf(std::int32_t leaf);
+        void removeLeaf(std::int32_t leaf);
+
+        /**
+         * Recomputes the bounds and heights from @p node up to the root, rotating unbalanced nodes on the way.
+         */
+        void refitUpwards(std::int32_t node);
+
+        /**
+         * Performs a left or right rotation if the node @p a is imbalanced, returns the new root of the subtree.
+         */
+        std::int32_t balance(std::int32_t a);
+
+        int validateSubtree(std::int32_t node, std::int32_t parent, bool& valid) const;
+
+        template <typename Visitor>
+        void forEachOverlap(const internal::Box& box, Visitor&& visit) const;
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename MovableShape>
+    bool DynamicAABBTree::moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos)
+    {
+        const Vector2 oldPosition = shape.bounds().getPosition();
+        shape.moveTo(newPos);
+
+        const Rect newBounds = shape.bounds();
+        return update(proxy, newBounds, newBounds.getPosition() - oldPosition);
+    }
+
+    template <typename MovableShape>
+    bool DynamicAABBTree::moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos)
+    {
+        shape.moveWith(changePos);
+        return update(proxy, shape.bounds(), changePos);
+    }
+}
@@ -0,0 +1,268 @@
+/**
+ * @file Fixed.hpp
+ * 
+ * @brief A file that contains a Q16.16 fixed-point number type for deterministic simulations.
+ * 
+ * Every operation, including the square root and the trigonometric functions, is done with integer
+ * arithmetic only, so the results are bit-identical on every platform and compiler.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace geometry {
+    class Fixed final {
+
+        // ==============================
+        //      Types and constants
+        // ==============================
+    public:
+        using Raw = std::int32_t;
+
+        static constexpr int FRACTION_BITS = 16;
+        static constexpr Raw ONE = Raw(1) << FRACTION_BITS;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        constexpr Fixed();
+
+        /**
+         * @brief Converts an integer exactly, values must fit in 16 signed bits.
+         */
+        constexpr Fixed(int value);
+
+        /**
+         * @brief Converts a floating point value, rounding to the nearest representable value.
+         * 
+         * The conversion is explicit because it is the only place where precision is lost.
+         */
+        explicit constexpr Fixed(float value);
+        explicit constexpr Fixed(double value);
+
+        /**
+         * @brief Builds a number from its raw Q16.16 representation.
+         */
+        static constexpr Fixed fromRaw(Raw raw);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        constexpr Raw getRaw() const;
+
+        explicit constexpr operator float() const;
+        explicit constexpr operator double() const;
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        constexpr Fixed operator -() const;
+        constexpr Fixed operator +() const;
+
+        constexpr Fixed operator +(Fixed other) const;
+        constexpr Fixed operator -(Fixed other) const;
+        constexpr Fixed operator *(Fixed other) const;
+
+        /**
+         * @throws std::domain_error if @p other is 0.
+         */
+        constexpr Fixed operator /(Fixed other) const;
+
+        constexpr Fixed& operator +=(Fixed other);
+        constexpr Fixed& operator -=(Fixed other);
+        constexpr Fixed& operator *=(Fixed other);
+        constexpr Fixed& operator /=(Fixed other);
+
+        constexpr bool operator ==(Fixed other) const;
+        constexpr bool operator !=(Fixed other) const;
+        constexpr bool operator <(Fixed other) const;
+        constexpr bool operator >(Fixed other) const;
+        constexpr bool operator <=(Fixed other) const;
+        constexpr bool operator >=(Fixed other) const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Raw raw;
+    };
+
+    // ==============================
+    //      Math functions
+    // ==============================
+
+    /**
+     * @brief Square root, computed with an integer digit-by-digit algorithm.
+     * 
+     * @throws std::domain_error if @p value is negative.
+     */
+    Fixed sqrt(Fixed value);
+
+    /**
+     * @brief Returns sqrt(x * x + y * y) without overflowing for large coordinates.
+     */
+    Fixed hypot(Fixed x, Fixed y);
+
+    /**
+     * @brief Sine and cosine of an angle in radians, computed with CORDIC.
+     */
+    Fixed sin(Fixed angleRadians);
+    Fixed cos(Fixed angleRadians);
+
+    /**
+     * @brief The angle of the vector (x, y) with OX, in [-pi, pi], computed with CORDIC.
+     */
+    Fixed atan2(Fixed y, Fixed x);
+
+    /**
+     * @brief Arc cosine in [0, pi], @p value is clamped to [-1, 1].
+     */
+    Fixed acos(Fixed value);
+
+    // ==============================
+    //      Inline definitions
+    // ==============================
+
+    constexpr Fixed::Fixed()
+        : raw(0)
+    {
+
+    }
+
+    constexpr Fixed::Fixed(int value)
+        : raw(static_cast<Raw>(static_cast<std::uint32_t>(value) << FRACTION_BITS))
+    {
+
+    }
+
+    constexpr Fixed::Fixed(float value)
+        : Fixed(static_cast<double>(value))
+    {
+
+    }
+
+    constexpr Fixed::Fixed(double value)
+        : raw(static_cast<Raw>(value * ONE + (value >= 0 ? 0.5 : -0.5)))
+    {
+
+    }
+
+    constexpr Fixed Fixed::fromRaw(Raw raw)
+    {
+        Fixed result;
+        result.raw = raw;
+        return result;
+    }
+
+    constexpr Fixed::Raw Fixed::getRaw() const
+    {
+        return raw;
+    }
+
+    constexpr Fixed::operator float() const
+    {
+        return static_cast<float>(raw) / ONE;
+    }
+
+    constexpr Fixed::operator double() const
+    {
+        return static_cast<double>(raw) / ONE;
+    }
+
+    constexpr Fixed Fixed::operator -() const
+    {
+        return fromRaw(-raw);
+    }
+
+    constexpr Fixed Fixed::operator +() const
+    {
+        return *this;
+    }
+
+    constexpr Fixed Fixed::operator +(Fixed other) const
+    {
+        return fromRaw(raw + other.raw);
+    }
+
+    constexpr Fixed Fixed::operator -(Fixed other) const
+    {
+        return fromRaw(raw - other.raw);
+    }
+
+    constexpr Fixed Fixed::operator *(Fixed other) const
+    {
+        constexpr std::int64_t half = std::int64_t(1) << (FRACTION_BITS - 1);
+        return fromRaw(static_cast<Raw>((static_cast<std::int64_t>(raw) * other.raw + half) >> FRACTION_BITS));
+    }
+
+    constexpr Fixed Fixed::operator /(Fixed other) const
+    {
+        if (other.raw == 0)
+        {
+            throw std::domain_error("Fixed point division by 0!");
+        }
+        // Rounds to the nearest value instead of truncating towards 0.
+        std::int64_t numerator = static_cast<std::int64_t>(raw) * ONE;
+        std::int64_t halfDenominator = other.raw / 2;
+        bool sameSign = (numerator < 0) == (other.raw < 0);
+        return fromRaw(static_cast<Raw>((sameSign ? numerator + halfDenominator : numerator - halfDenominator) / other.raw));
+    }
+
+    constexpr Fixed& Fixed::operator +=(Fixed other)
+    {
+        return *this = *this + other;
+    }
+
+    constexpr Fixed& Fixed::operator -=(Fixed other)
+    {
+        return *this = *this - other;
+    }
+
+    constexpr Fixed& Fixed::operator *=(Fixed other)
+    {
+        return *this = *this * other;
+    }
+
+    constexpr Fixed& Fixed::operator /=(Fixed other)
+    {
+        return *this = *this / other;
+    }
+
+    constexpr bool Fixed::operator ==(Fixed other) const
+    {
+        return raw == other.raw;
+    }
+
+    constexpr bool Fixed::operator !=(Fixed other) const
+    {
+        return raw != other.raw;
+    }
+
+    constexpr bool Fixed::operator <(Fixed other) const
+    {
+        return raw < other.raw;
+    }
+
+    constexpr bool Fixed::operator >(Fixed other) const
+    {
+        return raw > other.raw;
+    }
+
+    constexpr bool Fixed::operator <=(Fixed other) const
+    {
+        return raw <= other.raw;
+    }
+
+    constexpr bool Fixed::operator >=(Fixed other) const
+    {
+        return raw >= other.raw;
+    }
+}
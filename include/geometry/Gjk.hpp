@@ -0,0 +1,85 @@
+/**
+ * @file Gjk.hpp
+ * 
+ * @brief A file that contains the GJK distance and EPA penetration queries between convex shapes.
+ * 
+ * Both algorithms work on the Minkowski difference of the two shapes, which they only sample
+ * through @c Shape::support(), so one engine handles every pair of convex shapes. Neither
+ * query allocates memory.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <array>
+
+#include "geometry/Shape.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    /**
+     * @brief The simplex a query ended with, kept between frames to warm start the next query of the same pair.
+     * 
+     * Only the search directions are stored, the support points are recomputed from them since the
+     * shapes may have moved. A default constructed simplex starts a cold query.
+     */
+    struct GjkSimplex {
+        std::array<Vector2, 3> directions;
+        int count = 0;
+    };
+
+    /**
+     * @brief The result of a distance query.
+     */
+    struct GjkDistance {
+        /** @brief The distance between the shapes, 0 when they intersect. */
+        float distance = 0.0f;
+        /** @brief The point of the first shape closest to the second. */
+        Vector2 pointOnFirst;
+        /** @brief The point of the second shape closest to the first. */
+        Vector2 pointOnSecond;
+        /** @brief The number of support point evaluations, a warm started query usually needs fewer. */
+        int iterations = 0;
+    };
+
+    class Gjk final {
+
+        // ==============================
+        //      Queries
+        // ==============================
+    public:
+        /**
+         * @brief Computes the distance and the closest points between two convex shapes.
+         * 
+         * @param first The first shape.
+         * @param second The second shape.
+         * @param result Receives the distance and the closest points.
+         * @param simplex When given, the query starts from it and it receives the final simplex.
+         * 
+         * @returns true if the shapes intersect or touch, false otherwise.
+         */
+        static bool distance(const Shape& first, const Shape& second, GjkDistance& result, GjkSimplex* simplex = nullptr);
+
+        /**
+         * @brief Checks if two convex shapes intersect, shapes that only touch count as intersecting.
+         * 
+         * @param simplex When given, the query starts from it and it receives the final simplex.
+         */
+        static bool intersects(const Shape& first, const Shape& second, GjkSimplex* simplex = nullptr);
+
+        /**
+         * @brief Computes the minimum translation vector of two intersecting convex shapes with EPA.
+         * 
+         * The polytope grows inside a fixed size buffer, curved shapes stop refining once it is full.
+         * 
+         * @param translation Receives the minimum translation vector when the shapes intersect, moving
+         * @p first with it separates the shapes. It is left untouched otherwise.
+         * @param simplex When given, the query starts from it and it receives the final GJK simplex.
+         * 
+         * @returns true if the shapes intersect, false otherwise.
+         */
+        static bool penetration(const Shape& first, const Shape& second, Vector2& translation, GjkSimplex* simplex = nullptr);
+    };
+}
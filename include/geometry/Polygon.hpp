@@ -9,16 +9,37 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 
 
 #include "geometry/Vector2.hpp"
+#include "geometry/Rect.hpp"
 #include "geometry/Shape.hpp"
 #include "geometry/Movable.hpp"
+#include "geometry/SmallVector.hpp"
+
+/**
+ * @brief The number of vertices a polygon stores inline, beyond it they move to the heap.
+ * 
+ * Define it before including this header, or on the command line, to tune it for the data at hand.
+ */
+#ifndef GEOMETRY_POLYGON_INLINE_VERTICES
+    #define GEOMETRY_POLYGON_INLINE_VERTICES 8
+#endif
 
 namespace geometry {
+    struct Affine2;
+    class ThreadPool;
+
     class Polygon : public Shape, public Movable {
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using VertexStorage = SmallVector<Vector2, GEOMETRY_POLYGON_INLINE_VERTICES>;
+
         // ==============================
         //      Constructors and destructor
         // ==============================
@@ -27,36 +48,146 @@ namespace geometry {
         Polygon(Vector2 firstVertice, Vector2 secondVertice, Vector2 thirdVertice, Vertices... restVertices)
             : vertices{firstVertice, secondVertice, thirdVertice, restVertices...}
         {
-
+            updateProperties();
         }
 
         Polygon(const Polygon& src);
 
+        /**
+         * @brief Takes the vertices of @p src, which is left without vertices and with null sums.
+         * 
+         * A moved-from polygon may only be assigned to or destroyed, @c addVertex() and @c transform() throw on it.
+         */
+        Polygon(Polygon&& src) noexcept;
+
         virtual ~Polygon() = default;
 
         // ==============================
         //      Public methods
         // ==============================
     public:
+        /**
+         * @brief Returns the area enclosed by the vertices, in O(1).
+         * 
+         * The area, perimeter, centroid and bounds are kept up to date as running sums: adding a
+         * vertex only replaces the closing edge, and a translation shifts them without a rescan.
+         */
         double area() const override;
         double perimeter() const override;
+
+        /**
+         * @brief Returns the centroid of the enclosed area, or the average of the vertices when the area is null.
+         */
         Vector2 center() const override;
+        Rect bounds() const override;
+        Vector2 support(const Vector2& direction) const override;
 
         void moveTo(const Vector2& newPos) override;
         void moveWith(const Vector2& changePos) override;
 
+        /**
+         * @throws std::runtime_error If the polygon was moved from.
+         */
         Polygon& addVertex(const Vector2 vertex);
 
+        /**
+         * @brief Applies an affine transform to every vertex in a single pass.
+         * 
+         * A chain of translations, rotations and scalings composed into one @c Affine2 costs
+         * one pass over the vertices instead of one pass per operation. The edge normals and the
+         * running sums are recomputed in that same pass.
+         * 
+         * @param transform The transform to apply.
+         * 
+         * @throws std::runtime_error If the polygon was moved from.
+         * 
+         * @returns Polygon& A reference to the current object.
+         */
+        Polygon& transform(const Affine2& transform);
+
+        /**
+         * @brief Replaces the vertices with their convex hull, in counter-clockwise order.
+         * 
+         * Vertices inside the hull or on its edges are dropped, see @c ConvexHull::compute().
+         * 
+         * @param pool The threads used when the polygon has at least @c ConvexHull::PARALLEL_THRESHOLD vertices, if any.
+         * 
+         * @throws std::runtime_error If all the vertices are collinear, the polygon is left unchanged.
+         * 
+         * @returns Polygon& A reference to the current object.
+         */
+        Polygon& putVerticesInOrder(ThreadPool* pool = nullptr);
+
+        /**
+         * @brief Triangulates the polygon, which must be simple, without copying its vertices.
+         * 
+         * @param indices Receives three indices into @c getVertices() per triangle, every triangle in
+         * counter-clockwise order, see @c Triangulator::triangulate(). It is cleared first.
+         * 
+         * @throws std::runtime_error If the polygon has less than 3 vertices or is not simple.
+         * 
+         * @returns The number of triangles.
+         */
+        std::size_t triangulate(std::vector<std::uint32_t>& indices) const;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        const VertexStorage& getVertices() const;
+
+        /**
+         * @brief Returns the unit normals of the edges, the i-th one belongs to the edge from vertex i to vertex i + 1.
+         * 
+         * The normals are kept up to date when the vertices change, translations leave them untouched, so
+         * the separating axis test reads them directly instead of normalizing every edge on every call.
+         * A degenerate edge has a null normal.
+         */
+        const VertexStorage& getEdgeNormals() const;
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        Polygon& operator =(const Polygon& other);
+        Polygon& operator =(Polygon&& other) noexcept;
+
         // ==============================
         //      Private fields
         // ==============================
     private:
-        std::vector<Vector2> vertices;
+        VertexStorage vertices;
+        VertexStorage edgeNormals;
+
+        // Running sums over the edges (a, b): cross(a, b), |b - a|, (a.x + b.x) * cross(a, b) and (a.y + b.y) * cross(a, b).
+        double doubleSignedArea;
+        double edgeLenghtSum;
+        double momentX, momentY;
+        Vector2 vertexSum;
+        Vector2 minCorner, maxCorner;
 
         // ==============================
         //      Private methods
         // ==============================
     private:
-        void putVerticesInOrder();
+        void updateEdgeNormal(std::size_t edge);
+
+        /**
+         * Adds the contribution of the edge from @p start to @p end to the running sums, or removes it
+         * when @p sign is -1, and returns the lenght of the edge.
+         */
+        float accumulateEdge(const Vector2& start, const Vector2& end, double sign);
+
+        /**
+         * Adds a vertex and the edge starting at it to the running sums, and stores the normal of the edge.
+         */
+        void accumulateVertex(std::size_t index);
+        void resetProperties(const Vector2& firstVertex);
+        void throwIfMovedFrom() const;
+
+        /**
+         * Recomputes the normals and the running sums in one pass over the vertices.
+         */
+        void updateProperties();
     };
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * @file PreparedPolygon.hpp
+ * 
+ * @brief A file that contains a polygon prepared for many point containment queries.
+ * 
+ * The bounds of the polygon are cut into a grid of cells and every cell lists the edges that touch it.
+ * Every cell also knows whether its bottom right corner is inside the polygon, so a query finds its
+ * cell with two multiplications and only tests the edges of that cell, a handful for most polygons
+ * whatever their size. Shapes whose edges all cross a large part of the bounds, like thin stars, get a
+ * coarser grid so the memory stays linear, and their queries test more edges.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/ThreadPool.hpp"
+#include "geometry/Vector2.hpp"
+#include "geometry/internal/UniformGrid.hpp"
+
+namespace geometry {
+    class PreparedPolygon final {
+        // ==============================
+        //      Constants
+        // ==============================
+    public:
+        /**
+         * @brief The number of cells aimed at per edge of the polygon.
+         */
+        static constexpr std::size_t CELLS_PER_EDGE = 2;
+
+        /**
+         * @brief The average number of cells an edge may be listed in, the grid is made coarser until it fits.
+         * 
+         * Long edges cross many cells of a fine grid, this bounds the memory to O(n) for any shape.
+         */
+        static constexpr std::size_t MAX_ENTRIES_PER_EDGE = 16;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @brief Builds the grid of @p polygon, which may be non-convex, in O(n) memory.
+         * 
+         * The prepared polygon keeps its own copy of the edges, later changes to @p polygon are not seen.
+         */
+        explicit PreparedPolygon(const Polygon& polygon);
+
+        // ==============================
+        //      Queries
+        // ==============================
+    public:
+        /**
+         * @brief Checks if @p point is inside the polygon, using the even-odd rule.
+         * 
+         * A point on the boundary is inside for the left and bottom edges and outside for the right and top ones,
+         * so two polygons sharing an edge never both contain a point of it.
+         */
+        bool contains(const Vector2& point) const;
+
+        /**
+         * @brief Runs @c contains() on every point of [points, points + count).
+         * 
+         * @param results Receives 1 for every point inside the polygon and 0 for the others, it is resized to @p count.
+         * @param pool The threads to split the points over, if any.
+         * 
+         * @returns The number of points inside the polygon.
+         */
+        std::size_t contains(const Vector2* points, std::size_t count, std::vector<std::uint8_t>& results, ThreadPool* pool = nullptr) const;
+        std::size_t contains(const std::vector<Vector2>& points, std::vector<std::uint8_t>& results, ThreadPool* pool = nullptr) const;
+
+        std::size_t getCellCount() const;
+
+        /**
+         * @brief Returns the number of edges listed over all the cells.
+         */
+        std::size_t getEntryCount() const;
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Edge {
+            Vector2 start;
+            Vector2 end;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        internal::UniformGrid grid;
+
+        // The edges of cell i, row-major, are cellEdges[cellStarts[i]] to cellEdges[cellStarts[i + 1]].
+        std::vector<std::size_t> cellStarts;
+        std::vector<Edge> cellEdges;
+
+        /**
+         * 1 for the cells whose bottom right corner is inside the polygon.
+         */
+        std::vector<std::uint8_t> cornerInside;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        /**
+         * Fills the cells of a grid of the given size, unless the edges would be listed more than
+         * @p maxEntries times over all the cells.
+         * 
+         * @returns false if the grid was given up for having too many entries.
+         */
+        bool buildGrid(const std::vector<Edge>& edges, std::size_t columnCount, std::size_t rowCount, std::size_t maxEntries);
+    };
+}
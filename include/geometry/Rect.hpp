@@ -31,16 +31,23 @@ namespace geometry {
         double area() const override;
         double perimeter() const override;
         Vector2 center() const override;
+        Rect bounds() const override;
+        Vector2 support(const Vector2& direction) const override;
 
         void moveTo(const Vector2& newPos) override;
         void moveWith(const Vector2& posChange) override;
         Rect& scaleWith(float factor);
-        Rect& resize(double width, double height);
+        Rect& resize(float width, float height);
         Rect& rotate90DegreesClockwise();
         Rect& rotate90DegreesTrigonometrically();
 
         bool isSquare() const;
         bool isValid() const;
+
+        /**
+         * @brief Checks if the current rect and @p other overlap, rects that only touch count as overlapping.
+         */
+        bool overlaps(const Rect& other) const;
         // ==============================
         //      Getters and setters
         // ==============================
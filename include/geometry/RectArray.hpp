@@ -0,0 +1,83 @@
+/**
+ * @file RectArray.hpp
+ * 
+ * @brief A file that contains a structure-of-arrays container of axis-aligned rects for the batch collision kernels.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/Rect.hpp"
+#include "geometry/internal/AlignedAllocator.hpp"
+#include "geometry/internal/simd.hpp"
+
+namespace geometry {
+    class RectArray final {
+
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using Buffer = std::vector<float, internal::AlignedAllocator<float, internal::simd::ALIGNMENT>>;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        RectArray() = default;
+
+        /**
+         * @brief Constructs the array from the extents of @p rects.
+         */
+        RectArray(const std::vector<Rect>& rects);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        std::size_t size() const;
+        bool empty() const;
+
+        /**
+         * @brief Rebuilds the rect at position @p index from its stored extents.
+         */
+        Rect get(std::size_t index) const;
+
+        // Object modifier methods
+
+        void reserve(std::size_t capacity);
+        void clear();
+        void push_back(const Rect& rect);
+
+        /**
+         * @brief Overwrites the extents stored at position @p index.
+         */
+        RectArray& set(std::size_t index, const Rect& rect);
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        /**
+         * @brief Direct access to the extent buffers, aligned to @c internal::simd::ALIGNMENT.
+         */
+        const float* minXData() const;
+        const float* minYData() const;
+        const float* maxXData() const;
+        const float* maxYData() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Buffer minXs, minYs;
+        Buffer maxXs, maxYs;
+    };
+}
@@ -0,0 +1,64 @@
+/**
+ * @file ScalarTraits.hpp
+ * 
+ * @brief A file that contains the per-type constants and math functions used by the templated geometry types.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include "geometry/Fixed.hpp"
+#include "geometry/internal/common.hpp"
+
+namespace geometry {
+
+    /**
+     * @brief Describes a coordinate type.
+     * 
+     * Every specialization provides:
+     * - @c epsilon(), the tolerance used by the equality checks of that type;
+     * - @c sqrt(), @c hypot(), @c sin(), @c cos() and @c acos() for that type.
+     */
+    template <typename T>
+    struct ScalarTraits;
+
+    template <>
+    struct ScalarTraits<float> {
+        static constexpr float epsilon() { return FLOAT_EPSILON; }
+
+        static float sqrt(float value) { return std::sqrt(value); }
+        static float hypot(float x, float y) { return std::sqrt(x * x + y * y); }
+        static float sin(float angle) { return std::sin(angle); }
+        static float cos(float angle) { return std::cos(angle); }
+        static float acos(float value) { return std::acos(value); }
+    };
+
+    template <>
+    struct ScalarTraits<double> {
+        static constexpr double epsilon() { return 1.0e-12; }
+
+        static double sqrt(double value) { return std::sqrt(value); }
+        static double hypot(double x, double y) { return std::sqrt(x * x + y * y); }
+        static double sin(double angle) { return std::sin(angle); }
+        static double cos(double angle) { return std::cos(angle); }
+        static double acos(double value) { return std::acos(value); }
+    };
+
+    /**
+     * Fixed point values are exact, so only bit-identical values compare equal.
+     */
+    template <>
+    struct ScalarTraits<Fixed> {
+        static constexpr Fixed epsilon() { return Fixed::fromRaw(1); }
+
+        static Fixed sqrt(Fixed value) { return geometry::sqrt(value); }
+        static Fixed hypot(Fixed x, Fixed y) { return geometry::hypot(x, y); }
+        static Fixed sin(Fixed angle) { return geometry::sin(angle); }
+        static Fixed cos(Fixed angle) { return geometry::cos(angle); }
+        static Fixed acos(Fixed value) { return geometry::acos(value); }
+    };
+}
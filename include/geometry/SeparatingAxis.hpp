@@ -0,0 +1,139 @@
+/**
+ * @file SeparatingAxis.hpp
+ * 
+ * @brief A file that contains the separating axis narrowphase for convex polygons, rects and triangles.
+ * 
+ * Two convex shapes do not intersect exactly when their projections on one of the edge normals
+ * do not overlap. When they do intersect, the normal with the smallest overlap gives the minimum
+ * translation vector that pushes them apart.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Triangle.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    /**
+     * @brief A read-only view of the vertices and edge normals of a convex shape.
+     * 
+     * A polygon is viewed in place through its precomputed normals, a rect needs only the two axis
+     * directions and a triangle gets its three normals computed once, when the view is made. The view
+     * must not outlive the shape and the polygon must be convex.
+     */
+    class ConvexView final {
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        ConvexView(const Polygon& polygon);
+        ConvexView(const Rect& rect);
+        ConvexView(const Triangle& triangle);
+
+        // The view may point into its own storage, so it is not copied.
+        ConvexView(const ConvexView&) = delete;
+        ConvexView& operator =(const ConvexView&) = delete;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        const Vector2* getVertices() const;
+        std::size_t getVertexCount() const;
+
+        const Vector2* getNormals() const;
+        std::size_t getNormalCount() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        const Vector2* vertices;
+        std::size_t vertexCount;
+        const Vector2* normals;
+        std::size_t normalCount;
+
+        std::array<Vector2, 4> ownVertices;
+        std::array<Vector2, 3> ownNormals;
+    };
+
+    class SeparatingAxis final {
+
+        // ==============================
+        //      Narrowphase queries
+        // ==============================
+    public:
+        /**
+         * @brief Tests two convex shapes for intersection, shapes that only touch count as intersecting.
+         * 
+         * @param first The first shape.
+         * @param second The second shape.
+         * @param translation Receives the minimum translation vector when the shapes intersect, moving
+         * @p first with it separates the shapes. It is left untouched otherwise.
+         * 
+         * @returns true if the shapes intersect, false otherwise.
+         */
+        static bool collide(const ConvexView& first, const ConvexView& second, Vector2& translation);
+
+        /**
+         * @brief Searches every edge normal of both shapes for one that separates them.
+         * 
+         * @param axis Receives the separating axis, when one is found.
+         * 
+         * @returns true if a separating axis was found, false if the shapes intersect.
+         */
+        static bool findSeparatingAxis(const ConvexView& first, const ConvexView& second, Vector2& axis);
+
+        /**
+         * @brief Checks whether the projections of the two shapes on @p axis are disjoint.
+         */
+        static bool separates(const ConvexView& first, const ConvexView& second, const Vector2& axis);
+    };
+
+    /**
+     * @brief Remembers the last separating axis of every pair of shapes.
+     * 
+     * A pair that did not intersect in the previous frame is most likely separated by the same axis
+     * again, so that axis is tried first and most non-colliding pairs exit after a single projection.
+     */
+    class SeparatingAxisCache final {
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Same as @c SeparatingAxis::collide(), trying the cached axis of @p pair first.
+         * 
+         * @param pair The ids of the two shapes, in either order.
+         * 
+         * @returns true if the shapes intersect, false otherwise.
+         */
+        bool collide(IndexPair pair, const ConvexView& first, const ConvexView& second, Vector2& translation);
+
+        /**
+         * @brief Drops the cached axis of @p pair, for example when one of its shapes is destroyed.
+         */
+        void forget(IndexPair pair);
+        void clear();
+
+        std::size_t size() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::unordered_map<std::uint64_t, Vector2> separatingAxes;
+    };
+}
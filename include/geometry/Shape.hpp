@@ -12,6 +12,8 @@
 #include <geometry/Vector2.hpp>
 
 namespace geometry {
+    class Rect;
+
     class Shape {
 
         // ==============================
@@ -30,5 +32,20 @@ namespace geometry {
         virtual double area() const = 0;
         virtual double perimeter() const = 0;
         virtual Vector2 center() const = 0;
+
+        /**
+         * @brief Returns the smallest axis-aligned rect that contains the shape.
+         */
+        virtual Rect bounds() const = 0;
+
+        /**
+         * @brief Returns the point of the shape that lies farthest along @p direction.
+         * 
+         * This is all the GJK and EPA queries need to know about a convex shape, so one engine
+         * covers every pair of shapes.
+         * 
+         * @param direction The search direction, it does not need to be normalized.
+         */
+        virtual Vector2 support(const Vector2& direction) const = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+/**
+ * @file ShapeBatches.hpp
+ * 
+ * @brief A file that contains a mixed collection of shapes stored as one homogeneous batch per type.
+ * 
+ * Bulk operations run one loop per batch, so within a loop every call goes to the same function
+ * and there is neither an indirect call nor a branch on the shape type.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "geometry/AnyShape.hpp"
+
+namespace geometry {
+    class ShapeBatches final {
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Appends a shape to the batch of its type.
+         */
+        template <typename T>
+        void add(T shape);
+        void add(const AnyShape& shape);
+
+        template <typename T>
+        std::vector<T>& getBatch();
+
+        template <typename T>
+        const std::vector<T>& getBatch() const;
+
+        /**
+         * @brief Calls @p visit once per batch with the vector of shapes of that type.
+         * 
+         * This is the entry point for custom bulk passes: the visitor is instantiated for every shape
+         * type, so the loop it runs over a batch is specialized for that type.
+         */
+        template <typename Visitor>
+        void visitBatches(Visitor&& visit);
+
+        template <typename Visitor>
+        void visitBatches(Visitor&& visit) const;
+
+        /**
+         * @brief Calls @p visit on every shape as its concrete type, batch after batch.
+         */
+        template <typename Visitor>
+        void forEach(Visitor&& visit);
+
+        template <typename Visitor>
+        void forEach(Visitor&& visit) const;
+
+        std::size_t size() const;
+        void clear();
+
+        // Bulk operations
+
+        double totalArea() const;
+        double totalPerimeter() const;
+
+        /**
+         * @brief Returns the smallest rect that contains every shape, or an empty rect at the origin when there are no shapes.
+         */
+        Rect totalBounds() const;
+
+        void moveWith(const Vector2& changePos);
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::tuple<std::vector<Rect>, std::vector<Polygon>, std::vector<Triangle>, std::vector<Circle>> batches;
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename T>
+    void ShapeBatches::add(T shape)
+    {
+        getBatch<T>().push_back(std::move(shape));
+    }
+
+    template <typename T>
+    std::vector<T>& ShapeBatches::getBatch()
+    {
+        return std::get<std::vector<T>>(batches);
+    }
+
+    template <typename T>
+    const std::vector<T>& ShapeBatches::getBatch() const
+    {
+        return std::get<std::vector<T>>(batches);
+    }
+
+    template <typename Visitor>
+    void ShapeBatches::visitBatches(Visitor&& visit)
+    {
+        std::apply([&visit](auto&... batch) { (..., visit(batch)); }, batches);
+    }
+
+    template <typename Visitor>
+    void ShapeBatches::visitBatches(Visitor&& visit) const
+    {
+        std::apply([&visit](const auto&... batch) { (..., visit(batch)); }, batches);
+    }
+
+    template <typename Visitor>
+    void ShapeBatches::forEach(Visitor&& visit)
+    {
+        visitBatches([&visit](auto& batch) {
+            for (auto& shape : batch)
+            {
+                visit(shape);
+            }
+        });
+    }
+
+    template <typename Visitor>
+    void ShapeBatches::forEach(Visitor&& visit) const
+    {
+        visitBatches([&visit](const auto& batch) {
+            for (const auto& shape : batch)
+            {
+                visit(shape);
+            }
+        });
+    }
+}
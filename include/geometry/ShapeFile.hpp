@@ -0,0 +1,216 @@
+/**
+ * @file ShapeFile.hpp
+ *
+ * @brief A file that contains the binary shape file format, its writer and its memory-mapped reader.
+ *
+ * A shape file is laid out as follows, every field in the byte order of the machine that wrote it:
+ *  - a @c ShapeFileHeader, at offset 0
+ *  - the vertex block, an array of @c Vector2 holding the vertices of every shape back to back
+ *  - the shape table, one @c ShapeRecord per shape
+ *
+ * Both arrays start at multiples of 8 bytes, so once the file is mapped the vertex block is used in
+ * place as a @c Vector2 buffer and loading costs nothing but the page faults of the data touched.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/ShapeViews.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    /**
+     * @brief The kinds of shapes a shape file stores.
+     */
+    enum class ShapeType : std::uint32_t {
+        /**
+         * Two vertices, the position followed by the width and height.
+         */
+        Rect = 1,
+
+        /**
+         * The vertices of the polygon, in order.
+         */
+        Polygon = 2
+    };
+
+    struct ShapeFileHeader {
+        /**
+         * @brief The version written by this code, readers reject any other one.
+         */
+        static constexpr std::uint32_t VERSION = 1;
+
+        /**
+         * @brief Read back as another value when the file was written with the other byte order.
+         */
+        static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrderMark;
+        std::uint64_t shapeCount;
+        std::uint64_t vertexCount;
+        std::uint64_t vertexOffset;
+        std::uint64_t tableOffset;
+    };
+
+    struct ShapeRecord {
+        ShapeType type;
+        std::uint32_t vertexCount;
+
+        /**
+         * @brief The index of the first vertex of the shape in the vertex block.
+         */
+        std::uint64_t firstVertex;
+    };
+
+    static_assert(sizeof(ShapeFileHeader) == 48, "The shape file header must keep its on-disk size");
+    static_assert(sizeof(ShapeRecord) == 16, "A shape record must keep its on-disk size");
+
+    /**
+     * @brief Writes a shape file, streaming the vertices to disk as shapes are added.
+     *
+     * Only the shape table, 16 bytes per shape, is held in memory until @c finish().
+     */
+    class ShapeFileWriter final {
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        /**
+         * @throws std::runtime_error If the file can not be opened for writing.
+         */
+        explicit ShapeFileWriter(const std::string& path);
+
+        ShapeFileWriter(const ShapeFileWriter&) = delete;
+        ShapeFileWriter& operator =(const ShapeFileWriter&) = delete;
+
+        /**
+         * @brief Closes the file, which is only valid if @c finish() was called.
+         */
+        ~ShapeFileWriter() = default;
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        ShapeFileWriter& add(const Rect& rect);
+        ShapeFileWriter& add(const Polygon& polygon);
+
+        /**
+         * @brief Adds a polygon given by its vertices, in order.
+         *
+         * @throws std::invalid_argument If there are less than 3 vertices.
+         */
+        ShapeFileWriter& addPolygon(const Vector2* vertices, std::size_t count);
+
+        /**
+         * @brief Writes the shape table and the header, after which no more shapes can be added.
+         *
+         * @throws std::runtime_error If writing fails or the file was already finished.
+         */
+        void finish();
+
+        std::size_t getShapeCount() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::ofstream stream;
+        std::vector<ShapeRecord> table;
+        std::uint64_t vertexCount;
+        bool finished;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void addShape(ShapeType type, const Vector2* vertices, std::size_t count);
+    };
+
+    /**
+     * @brief A shape file mapped into memory, read-only, whose shapes are handed out as views.
+     *
+     * The views point into the mapping and are valid as long as this object lives.
+     */
+    class MappedShapeFile final {
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        /**
+         * @throws std::runtime_error If the file can not be mapped, is not a shape file, has another
+         * version or byte order, or is too short for what its header says.
+         */
+        explicit MappedShapeFile(const std::string& path);
+
+        MappedShapeFile(const MappedShapeFile&) = delete;
+        MappedShapeFile& operator =(const MappedShapeFile&) = delete;
+
+        ~MappedShapeFile();
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Returns the number of shapes.
+         */
+        std::size_t size() const;
+
+        ShapeType getType(std::size_t shape) const;
+
+        /**
+         * @throws std::out_of_range If there is no such shape.
+         * @throws std::invalid_argument If the shape is not a polygon.
+         * @throws std::runtime_error If the record points outside the vertex block.
+         */
+        PolygonView getPolygon(std::size_t shape) const;
+
+        /**
+         * @throws std::out_of_range If there is no such shape.
+         * @throws std::invalid_argument If the shape is not a rectangle.
+         * @throws std::runtime_error If the record points outside the vertex block.
+         */
+        RectView getRect(std::size_t shape) const;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        /**
+         * @brief Returns the vertex block, the vertices of every shape back to back.
+         */
+        const Vector2* getVertexData() const;
+        std::size_t getVertexCount() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        void* mapping;
+        std::size_t mappingSize;
+
+        const ShapeFileHeader* header;
+        const ShapeRecord* table;
+        const Vector2* vertices;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        const ShapeRecord& record(std::size_t shape, ShapeType type) const;
+        void unmap();
+    };
+}
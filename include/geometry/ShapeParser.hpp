@@ -0,0 +1,142 @@
+/**
+ * @file ShapeParser.hpp
+ *
+ * @brief A file that contains a streaming parser for text files of points and polygons.
+ *
+ * The input is read in chunks cut at line ends, several chunks are parsed at once on a thread pool
+ * with @c std::from_chars, and the shapes of every chunk are handed to a callback in input order.
+ * Only a few chunks are held at a time, so files larger than memory can be parsed.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/ThreadPool.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    /**
+     * @brief The text formats understood by @c ShapeParser, both with one record per line.
+     */
+    enum class InputFormat {
+        /**
+         * Points as "x,y", columns after the second one are ignored. Empty lines and lines starting
+         * with '#' are skipped, and so is the first line when it does not hold a point, as a header.
+         */
+        CsvPoints,
+
+        /**
+         * Well-known text "POINT (x y)" and "POLYGON ((x y, ...), ...)" records. Only the outer ring of
+         * a polygon is kept, its closing vertex dropped. Empty lines and EMPTY shapes are skipped.
+         */
+        Wkt
+    };
+
+    /**
+     * @brief The shapes parsed from one chunk of the input.
+     */
+    struct ParsedBatch {
+        std::vector<Vector2> points;
+        std::vector<Polygon> polygons;
+
+        /**
+         * @brief The line of the input the chunk starts at, counting from 1.
+         */
+        std::size_t firstLine = 0;
+
+        /**
+         * @brief Removes the shapes, keeping the allocated memory.
+         */
+        void clear();
+    };
+
+    class ShapeParser final {
+
+        // ==============================
+        //      Constants
+        // ==============================
+    public:
+        static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1 << 22;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @param pool The threads parsing the chunks, the calling thread parses them alone if null.
+         * @param chunkSize The number of bytes read at a time. A chunk grows past it only to finish a
+         * line longer than the chunk.
+         *
+         * @throws std::invalid_argument If the chunk size is 0.
+         */
+        explicit ShapeParser(ThreadPool* pool = nullptr, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        using Consumer = std::function<void(ParsedBatch& batch)>;
+
+        /**
+         * @brief Parses the whole stream, handing every chunk to @p consumer in input order.
+         *
+         * At most two chunks per thread of the pool are held at a time: while the pool parses one group
+         * of chunks, the calling thread hands the previous group to @p consumer and reads the next one.
+         * The consumer must therefore not use the pool itself. The batch passed to the consumer is
+         * reused for later chunks, so the consumer should move out what it keeps.
+         *
+         * @throws std::runtime_error If a record is malformed, naming its line.
+         *
+         * @returns The number of points and polygons parsed.
+         */
+        std::size_t parse(std::istream& input, InputFormat format, const Consumer& consumer);
+
+        /**
+         * @brief Same as above, for the file at @p path.
+         *
+         * @throws std::runtime_error If the file can not be opened.
+         */
+        std::size_t parseFile(const std::string& path, InputFormat format, const Consumer& consumer);
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Chunk {
+            std::string text;
+            std::size_t firstLine = 0;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        ThreadPool* pool;
+        std::size_t chunkSize;
+
+        std::vector<Chunk> chunks;
+        std::vector<ParsedBatch> batches;
+        std::vector<std::vector<Vector2>> rings;
+        std::string carry;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        /**
+         * Reads the next chunk, ending at a line end unless the input ends first.
+         *
+         * @returns false if the input is exhausted.
+         */
+        bool readChunk(std::istream& input, Chunk& chunk, std::size_t& nextLine);
+    };
+}
@@ -0,0 +1,103 @@
+/**
+ * @file ShapeViews.hpp
+ * 
+ * @brief A file that contains read-only views of shapes whose vertices live in memory owned by someone else.
+ * 
+ * A view is two words and never copies the vertices, so it can point straight into a memory-mapped
+ * file. It stays valid only as long as the memory it points into.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class PolygonView final {
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        PolygonView(const Vector2* vertices = nullptr, std::size_t count = 0);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        double area() const;
+        double perimeter() const;
+        Rect bounds() const;
+
+        /**
+         * @brief Copies the vertices into a new polygon.
+         * 
+         * @throws std::runtime_error If the view has less than 3 vertices.
+         */
+        Polygon toPolygon() const;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        const Vector2* data() const;
+        std::size_t size() const;
+        const Vector2* begin() const;
+        const Vector2* end() const;
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        const Vector2& operator [](std::size_t index) const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        const Vector2* vertices;
+        std::size_t count;
+    };
+
+    /**
+     * @brief A view of a rectangle stored as two vectors, its position followed by its width and height.
+     */
+    class RectView final {
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        explicit RectView(const Vector2* corners = nullptr);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        double area() const;
+        double perimeter() const;
+
+        /**
+         * @brief Copies the rectangle into a new object.
+         */
+        Rect toRect() const;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        Vector2 getPosition() const;
+        float getWidth() const;
+        float getHeight() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        const Vector2* corners;
+    };
+}
@@ -0,0 +1,344 @@
+/**
+ * @file ShapeWorld.hpp
+ * 
+ * @brief A file that contains a container owning every shape of a scene, stored per type in contiguous pools.
+ * 
+ * Each pool keeps its shapes packed in one array, so iterating a type touches memory linearly. Rects,
+ * triangles, circles and polygons whose vertices fit inline (@c GEOMETRY_POLYGON_INLINE_VERTICES) own
+ * no other memory, so tearing down their pool frees a single block. Larger polygons also free their
+ * own vertex and normal buffers, two per polygon. The shapes are reached through generational handles,
+ * which stay valid while the shapes move around inside the pool and detect when the shape they
+ * named was destroyed. The pointers returned by @c get() do not, keep the handle and resolve it again.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "geometry/Circle.hpp"
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Triangle.hpp"
+
+namespace geometry {
+    /**
+     * @brief Names a shape of type @p T inside a @c ShapeWorld.
+     * 
+     * A default constructed handle names no shape.
+     */
+    template <typename T>
+    struct ShapeHandle {
+        std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t generation = 0;
+
+        bool operator ==(const ShapeHandle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator !=(const ShapeHandle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @brief The storage of one shape type: a dense array of shapes plus a table of slots that maps handles to them.
+     * 
+     * Destroying a shape moves the last one into its place and puts its slot on a free list, so both
+     * creation and destruction are O(1) and the array never has holes. The array is the only allocation
+     * of the pool as long as the shapes hold their data inline.
+     */
+    template <typename T>
+    class ShapePool final {
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        template <typename ...Arguments>
+        ShapeHandle<T> create(Arguments&&... arguments);
+
+        /**
+         * @throws std::invalid_argument If @p handle does not name a live shape.
+         */
+        void destroy(ShapeHandle<T> handle);
+
+        /**
+         * @brief Destroys every shape at once and invalidates all the handles, the memory is kept for reuse.
+         */
+        void reset();
+
+        /**
+         * @returns The shape named by @p handle, or nullptr if it was destroyed.
+         * 
+         * The pointer is only valid until the next @c create(), @c destroy() or @c reset() on this pool:
+         * creating may move the array, destroying moves the last shape into the freed place.
+         */
+        T* get(ShapeHandle<T> handle);
+        const T* get(ShapeHandle<T> handle) const;
+
+        bool isAlive(ShapeHandle<T> handle) const;
+        std::size_t size() const;
+
+        /**
+         * @brief Returns the shapes, packed and in no particular order.
+         */
+        std::vector<T>& getShapes();
+        const std::vector<T>& getShapes() const;
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Slot {
+            /** The index of the shape in the dense array, or of the next free slot while the slot is free. */
+            std::uint32_t target;
+            std::uint32_t generation;
+        };
+
+        static constexpr std::uint32_t NO_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<T> shapes;
+        std::vector<std::uint32_t> shapeSlots;
+        std::vector<Slot> slots;
+        std::uint32_t freeSlot = NO_SLOT;
+    };
+
+    class ShapeWorld final {
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Creates a shape of type @p T, constructed from @p arguments, in the pool of its type.
+         */
+        template <typename T, typename ...Arguments>
+        ShapeHandle<T> create(Arguments&&... arguments);
+
+        /**
+         * @throws std::invalid_argument If @p handle does not name a live shape.
+         */
+        template <typename T>
+        void destroy(ShapeHandle<T> handle);
+
+        /**
+         * @returns The shape named by @p handle, or nullptr if it was destroyed.
+         * 
+         * The pointer is only valid until the next @c create(), @c destroy() or @c reset() on the pool of @p T.
+         */
+        template <typename T>
+        T* get(ShapeHandle<T> handle);
+
+        template <typename T>
+        const T* get(ShapeHandle<T> handle) const;
+
+        template <typename T>
+        bool isAlive(ShapeHandle<T> handle) const;
+
+        template <typename T>
+        ShapePool<T>& getPool();
+
+        template <typename T>
+        const ShapePool<T>& getPool() const;
+
+        /**
+         * @brief Calls @p visit on every shape, pool after pool, each pool in memory order.
+         * 
+         * @param visit Called with a reference to each shape as its concrete type.
+         */
+        template <typename Visitor>
+        void forEach(Visitor&& visit);
+
+        /**
+         * @brief Returns the number of shapes of every type.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Destroys every shape at the end of a frame or level, in one pass per pool.
+         * 
+         * All the handles become invalid, the memory of the pools is kept for the next frame.
+         */
+        void reset();
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::tuple<ShapePool<Rect>, ShapePool<Polygon>, ShapePool<Triangle>, ShapePool<Circle>> pools;
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename T>
+    template <typename ...Arguments>
+    ShapeHandle<T> ShapePool<T>::create(Arguments&&... arguments)
+    {
+        shapes.emplace_back(std::forward<Arguments>(arguments)...);
+
+        std::uint32_t index;
+        if (freeSlot != NO_SLOT)
+        {
+            index = freeSlot;
+            freeSlot = slots[index].target;
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(slots.size());
+            slots.push_back({0, 0});
+        }
+
+        slots[index].target = static_cast<std::uint32_t>(shapes.size() - 1);
+        shapeSlots.push_back(index);
+
+        return {index, slots[index].generation};
+    }
+
+    template <typename T>
+    void ShapePool<T>::destroy(ShapeHandle<T> handle)
+    {
+        if (!isAlive(handle))
+        {
+            throw std::invalid_argument("The handle does not name a live shape!");
+        }
+
+        Slot& slot = slots[handle.index];
+        const std::uint32_t removed = slot.target;
+        const std::uint32_t last = static_cast<std::uint32_t>(shapes.size() - 1);
+
+        if (removed != last)
+        {
+            shapes[removed] = std::move(shapes[last]);
+            shapeSlots[removed] = shapeSlots[last];
+            slots[shapeSlots[removed]].target = removed;
+        }
+        shapes.pop_back();
+        shapeSlots.pop_back();
+
+        slot.generation++;
+        slot.target = freeSlot;
+        freeSlot = handle.index;
+    }
+
+    template <typename T>
+    void ShapePool<T>::reset()
+    {
+        shapes.clear();
+        shapeSlots.clear();
+
+        freeSlot = NO_SLOT;
+        for (std::uint32_t i = static_cast<std::uint32_t>(slots.size()); i-- > 0;)
+        {
+            slots[i].generation++;
+            slots[i].target = freeSlot;
+            freeSlot = i;
+        }
+    }
+
+    template <typename T>
+    T* ShapePool<T>::get(ShapeHandle<T> handle)
+    {
+        return isAlive(handle) ? &shapes[slots[handle.index].target] : nullptr;
+    }
+
+    template <typename T>
+    const T* ShapePool<T>::get(ShapeHandle<T> handle) const
+    {
+        return isAlive(handle) ? &shapes[slots[handle.index].target] : nullptr;
+    }
+
+    template <typename T>
+    bool ShapePool<T>::isAlive(ShapeHandle<T> handle) const
+    {
+        // A free slot always has a newer generation than the handles that named its last shape.
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    template <typename T>
+    std::size_t ShapePool<T>::size() const
+    {
+        return shapes.size();
+    }
+
+    template <typename T>
+    std::vector<T>& ShapePool<T>::getShapes()
+    {
+        return shapes;
+    }
+
+    template <typename T>
+    const std::vector<T>& ShapePool<T>::getShapes() const
+    {
+        return shapes;
+    }
+
+    template <typename T, typename ...Arguments>
+    ShapeHandle<T> ShapeWorld::create(Arguments&&... arguments)
+    {
+        return getPool<T>().create(std::forward<Arguments>(arguments)...);
+    }
+
+    template <typename T>
+    void ShapeWorld::destroy(ShapeHandle<T> handle)
+    {
+        getPool<T>().destroy(handle);
+    }
+
+    template <typename T>
+    T* ShapeWorld::get(ShapeHandle<T> handle)
+    {
+        return getPool<T>().get(handle);
+    }
+
+    template <typename T>
+    const T* ShapeWorld::get(ShapeHandle<T> handle) const
+    {
+        return getPool<T>().get(handle);
+    }
+
+    template <typename T>
+    bool ShapeWorld::isAlive(ShapeHandle<T> handle) const
+    {
+        return getPool<T>().isAlive(handle);
+    }
+
+    template <typename T>
+    ShapePool<T>& ShapeWorld::getPool()
+    {
+        return std::get<ShapePool<T>>(pools);
+    }
+
+    template <typename T>
+    const ShapePool<T>& ShapeWorld::getPool() const
+    {
+        return std::get<ShapePool<T>>(pools);
+    }
+
+    template <typename Visitor>
+    void ShapeWorld::forEach(Visitor&& visit)
+    {
+        std::apply([&visit](auto&... pool) {
+            (..., [&visit](auto& shapes) {
+                for (auto& shape : shapes)
+                {
+                    visit(shape);
+                }
+            }(pool.getShapes()));
+        }, pools);
+    }
+}
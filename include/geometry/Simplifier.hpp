@@ -0,0 +1,178 @@
+/**
+ * @file Simplifier.hpp
+ *
+ * @brief A file that contains the simplification of polylines and polygons, reducing their vertices
+ * while staying within a tolerance.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class Simplifier final {
+
+        // ==============================
+        //      Douglas-Peucker
+        // ==============================
+    public:
+        /**
+         * @brief Simplifies an open polyline with the Douglas-Peucker algorithm, without recursion.
+         *
+         * Every dropped point lies within @p tolerance of the segment of the output that replaces it.
+         * The first and last points are always kept.
+         *
+         * @param tolerance The largest distance allowed between a dropped point and the output.
+         * @param output Receives the kept points, in order. It is cleared first.
+         *
+         * @throws std::invalid_argument If the tolerance is negative.
+         *
+         * @returns The number of points in @p output.
+         */
+        std::size_t douglasPeucker(const Vector2* points, std::size_t count, float tolerance, std::vector<Vector2>& output);
+
+        /**
+         * @brief Same as above, receiving the indices of the kept points instead of the points.
+         */
+        std::size_t douglasPeucker(const Vector2* points, std::size_t count, float tolerance, std::vector<std::size_t>& indices);
+
+        /**
+         * @brief Simplifies the closed outline of @p polygon with the Douglas-Peucker algorithm.
+         *
+         * The outline is cut at its first vertex and at the vertex farthest from it, and both halves
+         * are simplified as polylines, so at least 2 vertices are kept.
+         */
+        std::size_t douglasPeucker(const Polygon& polygon, float tolerance, std::vector<Vector2>& output);
+
+        // ==============================
+        //      Visvalingam-Whyatt
+        // ==============================
+    public:
+        /**
+         * @brief Simplifies an open polyline with the Visvalingam-Whyatt algorithm.
+         *
+         * The point forming the triangle of smallest area with its neighbours is dropped, over and
+         * over, until every triangle left is at least @p minArea. The triangles are kept in a binary
+         * heap, which makes it O(n log n). The first and last points are always kept.
+         *
+         * @param minArea The smallest triangle area a kept point may have.
+         * @param output Receives the kept points, in order. It is cleared first.
+         *
+         * @throws std::invalid_argument If the area is negative.
+         *
+         * @returns The number of points in @p output.
+         */
+        std::size_t visvalingam(const Vector2* points, std::size_t count, float minArea, std::vector<Vector2>& output);
+
+        /**
+         * @brief Simplifies the closed outline of @p polygon with the Visvalingam-Whyatt algorithm,
+         * keeping at least 3 vertices.
+         */
+        std::size_t visvalingam(const Polygon& polygon, float minArea, std::vector<Vector2>& output);
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Range {
+            std::size_t first;
+            std::size_t last;
+        };
+
+        struct HeapEntry {
+            double area;
+            std::size_t point;
+            std::uint32_t version;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<Range> ranges;
+        std::vector<std::uint8_t> kept;
+
+        std::vector<HeapEntry> heap;
+        std::vector<std::size_t> previous;
+        std::vector<std::size_t> next;
+        std::vector<std::uint32_t> versions;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        /**
+         * Marks the points of [first, last] kept by Douglas-Peucker, index count standing for point 0.
+         */
+        void markDouglasPeucker(const Vector2* points, std::size_t count, std::size_t first, std::size_t last, double toleranceSquared);
+        std::size_t runVisvalingam(const Vector2* points, std::size_t count, bool closed, float minArea, std::vector<Vector2>& output);
+    };
+
+    /**
+     * @brief Simplifies a polyline that arrives in chunks, holding at most a window of points at a time.
+     *
+     * The points waiting for a decision are simplified with Douglas-Peucker whenever they fill the
+     * window. Everything up to the last kept point but one is emitted, and the rest waits for more
+     * input, so every dropped point stays within the tolerance of the output.
+     */
+    class StreamingSimplifier final {
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @param tolerance The largest distance allowed between a dropped point and the output.
+         * @param windowSize The largest number of points held at once.
+         *
+         * @throws std::invalid_argument If the tolerance is negative or the window holds less than 3 points.
+         */
+        explicit StreamingSimplifier(float tolerance, std::size_t windowSize = 4096);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Adds the next chunk of the polyline.
+         *
+         * @param output The points that are final are appended to it, it is not cleared.
+         */
+        void push(const Vector2* points, std::size_t count, std::vector<Vector2>& output);
+
+        /**
+         * @brief Ends the polyline, appending the points still waiting to @p output, and starts a new one.
+         */
+        void finish(std::vector<Vector2>& output);
+
+        /**
+         * @brief Returns the number of points waiting for a decision, never more than the window.
+         */
+        std::size_t getPendingCount() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        float tolerance;
+        std::size_t windowSize;
+
+        std::vector<Vector2> pending;
+        std::vector<std::size_t> keptIndices;
+        Simplifier simplifier;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void flushWindow(std::vector<Vector2>& output);
+    };
+}
@@ -0,0 +1,413 @@
+/**
+ * @file SmallVector.hpp
+ * 
+ * @brief A file that contains a vector that keeps its first elements inline and only spills to the heap beyond them.
+ * 
+ * Most polygons are triangles and quads, storing their vertices inside the object means creating,
+ * copying and moving them does not allocate.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace geometry {
+    /**
+     * @brief A contiguous sequence of trivially copyable values with room for @p InlineCapacity of them inside the object.
+     */
+    template <typename T, std::size_t InlineCapacity>
+    class SmallVector final {
+        static_assert(std::is_trivially_copyable<T>::value, "SmallVector copies its elements with memcpy");
+        static_assert(InlineCapacity > 0, "SmallVector needs room for at least one inline element");
+
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        SmallVector();
+        SmallVector(std::initializer_list<T> values);
+
+        template <typename InputIterator>
+        SmallVector(InputIterator first, InputIterator last);
+
+        SmallVector(const SmallVector& src);
+
+        /**
+         * @brief Steals the heap buffer of @p src, or copies its inline elements, @p src is left empty.
+         */
+        SmallVector(SmallVector&& src) noexcept;
+
+        ~SmallVector();
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        T* data();
+        const T* data() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        bool empty() const;
+
+        /**
+         * @brief Checks if the elements live inside the object, which is the case while there are at most @p InlineCapacity of them.
+         */
+        bool isInline() const;
+
+        T& front();
+        T& back();
+        const T& front() const;
+        const T& back() const;
+
+        void reserve(std::size_t newCapacity);
+        void resize(std::size_t newSize);
+        void clear();
+        void push_back(const T& value);
+
+        template <typename ...Arguments>
+        T& emplace_back(Arguments&&... arguments);
+
+        template <typename InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        // ==============================
+        //      Operators
+        // ==============================
+    public:
+        SmallVector& operator =(const SmallVector& other);
+        SmallVector& operator =(SmallVector&& other) noexcept;
+
+        T& operator [](std::size_t index);
+        const T& operator [](std::size_t index) const;
+
+        bool operator ==(const SmallVector& other) const;
+        bool operator !=(const SmallVector& other) const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        T* elements;
+        std::size_t count;
+        std::size_t allocated;
+        alignas(T) unsigned char inlineStorage[InlineCapacity * sizeof(T)];
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        T* inlineElements();
+        void grow(std::size_t minimumCapacity);
+        void release();
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>::SmallVector()
+        : elements(inlineElements()), count(0), allocated(InlineCapacity)
+    {
+
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>::SmallVector(std::initializer_list<T> values)
+        : SmallVector(values.begin(), values.end())
+    {
+
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    template <typename InputIterator>
+    SmallVector<T, InlineCapacity>::SmallVector(InputIterator first, InputIterator last)
+        : SmallVector()
+    {
+        assign(first, last);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>::SmallVector(const SmallVector& src)
+        : SmallVector()
+    {
+        assign(src.begin(), src.end());
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>::SmallVector(SmallVector&& src) noexcept
+        : SmallVector()
+    {
+        *this = std::move(src);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>::~SmallVector()
+    {
+        release();
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    T* SmallVector<T, InlineCapacity>::data()
+    {
+        return elements;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    const T* SmallVector<T, InlineCapacity>::data() const
+    {
+        return elements;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    typename SmallVector<T, InlineCapacity>::iterator SmallVector<T, InlineCapacity>::begin()
+    {
+        return elements;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    typename SmallVector<T, InlineCapacity>::iterator SmallVector<T, InlineCapacity>::end()
+    {
+        return elements + count;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    typename SmallVector<T, InlineCapacity>::const_iterator SmallVector<T, InlineCapacity>::begin() const
+    {
+        return elements;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    typename SmallVector<T, InlineCapacity>::const_iterator SmallVector<T, InlineCapacity>::end() const
+    {
+        return elements + count;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    std::size_t SmallVector<T, InlineCapacity>::size() const
+    {
+        return count;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    std::size_t SmallVector<T, InlineCapacity>::capacity() const
+    {
+        return allocated;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    bool SmallVector<T, InlineCapacity>::empty() const
+    {
+        return count == 0;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    bool SmallVector<T, InlineCapacity>::isInline() const
+    {
+        return elements == reinterpret_cast<const T*>(inlineStorage);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    T& SmallVector<T, InlineCapacity>::front()
+    {
+        return elements[0];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    T& SmallVector<T, InlineCapacity>::back()
+    {
+        return elements[count - 1];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    const T& SmallVector<T, InlineCapacity>::front() const
+    {
+        return elements[0];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    const T& SmallVector<T, InlineCapacity>::back() const
+    {
+        return elements[count - 1];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::reserve(std::size_t newCapacity)
+    {
+        if (newCapacity > allocated)
+        {
+            grow(newCapacity);
+        }
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::resize(std::size_t newSize)
+    {
+        reserve(newSize);
+        for (std::size_t i = count; i < newSize; i++)
+        {
+            new (elements + i) T();
+        }
+        count = newSize;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::clear()
+    {
+        count = 0;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    template <typename ...Arguments>
+    T& SmallVector<T, InlineCapacity>::emplace_back(Arguments&&... arguments)
+    {
+        if (count == allocated)
+        {
+            // The argument may point into the buffer that is about to be replaced.
+            const T value(std::forward<Arguments>(arguments)...);
+            grow(2 * allocated);
+            return *new (elements + count++) T(value);
+        }
+        return *new (elements + count++) T(std::forward<Arguments>(arguments)...);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    template <typename InputIterator>
+    void SmallVector<T, InlineCapacity>::assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+        {
+            reserve(static_cast<std::size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>& SmallVector<T, InlineCapacity>::operator =(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.count);
+            std::memcpy(static_cast<void*>(elements), other.elements, other.count * sizeof(T));
+            count = other.count;
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    SmallVector<T, InlineCapacity>& SmallVector<T, InlineCapacity>::operator =(SmallVector&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        if (other.isInline())
+        {
+            // The capacity never drops below the inline capacity, so the elements always fit.
+            std::memcpy(static_cast<void*>(elements), other.elements, other.count * sizeof(T));
+            count = other.count;
+        }
+        else
+        {
+            release();
+            elements = other.elements;
+            count = other.count;
+            allocated = other.allocated;
+
+            other.elements = other.inlineElements();
+            other.allocated = InlineCapacity;
+        }
+
+        other.count = 0;
+        return *this;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    T& SmallVector<T, InlineCapacity>::operator [](std::size_t index)
+    {
+        return elements[index];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    const T& SmallVector<T, InlineCapacity>::operator [](std::size_t index) const
+    {
+        return elements[index];
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    bool SmallVector<T, InlineCapacity>::operator ==(const SmallVector& other) const
+    {
+        return count == other.count && std::equal(begin(), end(), other.begin());
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    bool SmallVector<T, InlineCapacity>::operator !=(const SmallVector& other) const
+    {
+        return !(*this == other);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    T* SmallVector<T, InlineCapacity>::inlineElements()
+    {
+        return reinterpret_cast<T*>(inlineStorage);
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::grow(std::size_t minimumCapacity)
+    {
+        const std::size_t newCapacity = std::max(minimumCapacity, 2 * allocated);
+        T* newElements = static_cast<T*>(::operator new(newCapacity * sizeof(T), std::align_val_t(alignof(T))));
+
+        std::memcpy(static_cast<void*>(newElements), elements, count * sizeof(T));
+        release();
+
+        elements = newElements;
+        allocated = newCapacity;
+    }
+
+    template <typename T, std::size_t InlineCapacity>
+    void SmallVector<T, InlineCapacity>::release()
+    {
+        if (!isInline())
+        {
+            ::operator delete(elements, std::align_val_t(alignof(T)));
+        }
+    }
+}
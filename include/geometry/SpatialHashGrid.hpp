@@ -0,0 +1,204 @@
+/**
+ * @file SpatialHashGrid.hpp
+ * 
+ * @brief A file that contains a uniform grid broadphase for the @c CollisionChecker.
+ * 
+ * The bounds of every object are hashed into the cells they cover, so candidate pairs are only
+ * searched among objects that share a cell instead of among all pairs.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class SpatialHashGrid final {
+
+        // ==============================
+        //      Types and constants
+        // ==============================
+    public:
+        using ProxyId = std::uint32_t;
+
+        static constexpr ProxyId NULL_PROXY = std::numeric_limits<ProxyId>::max();
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        /**
+         * @brief Constructs an empty grid.
+         * 
+         * @param cellSize The side of a grid cell, ideally close to the size of a typical object.
+         * @param bucketCount The number of hash buckets, rounded up to a power of two.
+         * 
+         * @throws std::invalid_argument if @p cellSize is not positive.
+         */
+        explicit SpatialHashGrid(float cellSize, std::size_t bucketCount = 4096);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        /**
+         * @brief Finds every pair of objects whose bounds overlap.
+         * 
+         * Every pair is reported exactly once, as (smaller user data, larger user data).
+         * The buffer is cleared first, reusing it across frames avoids allocations.
+         * 
+         * @param pairs Receives the pairs of user data values.
+         * 
+         * @returns The number of pairs found.
+         */
+        std::size_t findPairs(std::vector<IndexPair>& pairs) const;
+
+        /**
+         * @brief Finds every object whose bounds overlap @p region.
+         * 
+         * @param hits Receives the user data of the objects, it is cleared first.
+         * 
+         * @returns The number of objects found.
+         */
+        std::size_t query(const Rect& region, std::vector<std::uint32_t>& hits) const;
+
+        std::size_t size() const;
+        float getCellSize() const;
+        std::uint32_t getUserData(ProxyId proxy) const;
+        Rect getBounds(ProxyId proxy) const;
+
+        // Object modifier methods
+
+        /**
+         * @brief Adds an object to the grid.
+         * 
+         * @param bounds The bounds of the object.
+         * @param userData A value identifying the object, reported back by the queries.
+         * 
+         * @returns The id used to update or remove the object later.
+         */
+        ProxyId insert(const Rect& bounds, std::uint32_t userData);
+        ProxyId insert(const Shape& shape, std::uint32_t userData);
+
+        /**
+         * @brief Removes an object from the grid, its id may be reused by later insertions.
+         * 
+         * @throws std::invalid_argument if @p proxy is not part of the grid.
+         */
+        void remove(ProxyId proxy);
+
+        /**
+         * @brief Stores the new bounds of an object.
+         * 
+         * The object is only moved between buckets when the range of cells it covers changes,
+         * small movements inside the same cells cost a single bounds copy.
+         * 
+         * @throws std::invalid_argument if @p proxy is not part of the grid.
+         */
+        void update(ProxyId proxy, const Rect& bounds);
+
+        /**
+         * @brief Moves a shape with @c Movable::moveTo() and updates its entry in the grid.
+         */
+        template <typename MovableShape>
+        void moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos);
+
+        /**
+         * @brief Moves a shape with @c Movable::moveWith() and updates its entry in the grid.
+         */
+        template <typename MovableShape>
+        void moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos);
+
+        /**
+         * @brief Changes the size of the cells and rebuckets every object.
+         * 
+         * @throws std::invalid_argument if @p cellSize is not positive.
+         */
+        void setCellSize(float cellSize);
+
+        /**
+         * @brief Removes every object, the memory of the buckets is kept for the next frame.
+         */
+        void clear();
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct CellRange {
+            std::int32_t minX, minY, maxX, maxY;
+
+            bool operator ==(const CellRange& other) const
+            {
+                return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+            }
+        };
+
+        struct Proxy {
+            float minX, minY, maxX, maxY;
+            CellRange cells;
+            std::uint32_t userData;
+            bool alive;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        float cellSize;
+        float inverseCellSize;
+        std::size_t bucketMask;
+
+        std::vector<std::vector<ProxyId>> buckets;
+        std::vector<Proxy> proxies;
+        std::vector<ProxyId> freeProxies;
+        std::size_t aliveCount = 0;
+
+        /**
+         * Bucket indices of the object being (re)inserted, kept as a member to avoid allocations.
+         */
+        std::vector<std::size_t> scratchBuckets;
+        mutable std::vector<std::size_t> scratchQueryBuckets;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        std::int32_t cellCoordinate(float coordinate) const;
+        std::size_t bucketOf(std::int32_t cellX, std::int32_t cellY) const;
+        CellRange cellRangeOf(float minX, float minY, float maxX, float maxY) const;
+        void collectBuckets(const CellRange& cells, std::vector<std::size_t>& out) const;
+        void addToBuckets(ProxyId proxy);
+        void removeFromBuckets(ProxyId proxy);
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename MovableShape>
+    void SpatialHashGrid::moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos)
+    {
+        shape.moveTo(newPos);
+        update(proxy, shape.bounds());
+    }
+
+    template <typename MovableShape>
+    void SpatialHashGrid::moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos)
+    {
+        shape.moveWith(changePos);
+        update(proxy, shape.bounds());
+    }
+}
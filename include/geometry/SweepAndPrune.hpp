@@ -0,0 +1,225 @@
+/**
+ * @file SweepAndPrune.hpp
+ * 
+ * @brief A file that contains a persistent sweep-and-prune broadphase for the @c CollisionChecker.
+ * 
+ * The sorted endpoint arrays on X and Y are kept from one frame to the next. Objects usually move
+ * only a little between frames, so re-sorting the endpoints of the moved objects takes a few swaps,
+ * and every swap tells exactly which pair started or stopped overlapping. Objects added or removed
+ * since the last update are merged in or dropped in one pass over the arrays instead.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/Vector2.hpp"
+#include "geometry/internal/Box.hpp"
+
+namespace geometry {
+    class SweepAndPrune final {
+
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using ProxyId = std::uint32_t;
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        /**
+         * @brief Returns every pair that overlapped at the last @c updatePairs() call.
+         * 
+         * @param pairs Receives the pairs as (smaller user data, larger user data), it is cleared first.
+         * 
+         * @returns The number of pairs.
+         */
+        std::size_t findPairs(std::vector<IndexPair>& pairs) const;
+
+        std::size_t size() const;
+        std::uint32_t getUserData(ProxyId proxy) const;
+
+        // Object modifier methods
+
+        /**
+         * @brief Adds an object, it takes part in the pairs from the next @c updatePairs() call.
+         * 
+         * The endpoints of the objects added between two updates are sorted and merged into the
+         * arrays together, so inserting many objects at once does not sift them one by one.
+         * 
+         * @param bounds The bounds of the object.
+         * @param userData A value identifying the object, reported back in the pairs.
+         * 
+         * @returns The id used to update or remove the object later.
+         */
+        ProxyId insert(const Rect& bounds, std::uint32_t userData);
+        ProxyId insert(const Shape& shape, std::uint32_t userData);
+
+        /**
+         * @brief Removes an object, its pairs are reported as removed by the next @c updatePairs() call.
+         * 
+         * The endpoints are only marked dead here and are dropped by the next @c updatePairs() call, the id
+         * can be reused after it.
+         * 
+         * @throws std::invalid_argument if @p proxy is not part of the broadphase.
+         */
+        void remove(ProxyId proxy);
+
+        /**
+         * @brief Stores the new bounds of an object, the endpoints are re-sorted by the next @c updatePairs() call.
+         * 
+         * @throws std::invalid_argument if @p proxy is not part of the broadphase.
+         */
+        void update(ProxyId proxy, const Rect& bounds);
+
+        /**
+         * @brief Moves a shape with @c Movable::moveTo() and records its new bounds.
+         */
+        template <typename MovableShape>
+        void moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos);
+
+        /**
+         * @brief Moves a shape with @c Movable::moveWith() and records its new bounds.
+         */
+        template <typename MovableShape>
+        void moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos);
+
+        /**
+         * @brief Re-sorts the endpoints of the objects updated since the last call and reports the pair changes.
+         * 
+         * Only the endpoints of the moved objects are sifted, so the cost depends on how many objects
+         * moved and how far, not on the total number of objects. Adding or removing objects since the
+         * last call costs one more pass over the endpoints, however many were added or removed.
+         * 
+         * @param added Receives the pairs that started overlapping, it is cleared first.
+         * @param removed Receives the pairs that stopped overlapping or lost an object, it is cleared first.
+         */
+        void updatePairs(std::vector<IndexPair>& added, std::vector<IndexPair>& removed);
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        struct Endpoint {
+            float value;
+            ProxyId proxy;
+            bool isMin;
+        };
+
+        struct Proxy {
+            /**
+             * The bounds as currently stored in the endpoint arrays.
+             */
+            internal::Box box;
+
+            /**
+             * The bounds recorded by @c update(), applied by the next @c updatePairs().
+             */
+            internal::Box pending;
+
+            std::uint32_t minIndex[2];
+            std::uint32_t maxIndex[2];
+            std::uint32_t userData;
+            bool alive;
+            bool moved;
+
+            /**
+             * Added since the last @c updatePairs(), its endpoints are not in the arrays yet.
+             */
+            bool fresh;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<Endpoint> axes[2];
+        std::vector<Proxy> proxies;
+        std::vector<ProxyId> freeProxies;
+        std::vector<ProxyId> movedProxies;
+        std::vector<ProxyId> insertedProxies;
+        std::vector<ProxyId> removedProxies;
+        std::size_t aliveCount = 0;
+
+        /**
+         * The overlapping pairs, keyed by proxy ids.
+         */
+        std::unordered_set<std::uint64_t> pairs;
+
+        /**
+         * The changes since the last @c updatePairs() call, keyed by user data.
+         */
+        std::unordered_set<std::uint64_t> pendingAdded;
+        std::unordered_set<std::uint64_t> pendingRemoved;
+
+        // Scratch space of the batch insertion
+        std::vector<Endpoint> newEndpoints;
+        std::vector<Endpoint> mergedEndpoints;
+        std::vector<ProxyId> activeOld;
+        std::vector<ProxyId> activeNew;
+        std::vector<std::uint32_t> activeSlots;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        /**
+         * Drops the pairs and endpoints of the removed objects and frees their ids.
+         */
+        void removeDeadProxies();
+
+        /**
+         * Merges the endpoints of the added objects into the arrays and finds their pairs with one sweep on X.
+         */
+        void insertNewProxies();
+
+        /**
+         * Stores in the objects the positions of the endpoints of @p axis.
+         */
+        void renumber(int axis);
+
+        void applyBounds(ProxyId proxy, const internal::Box& box);
+        void siftDown(int axis, std::uint32_t index);
+        void siftUp(int axis, std::uint32_t index);
+        void swapEndpoints(int axis, std::uint32_t first, std::uint32_t second);
+
+        /**
+         * Called when the endpoint at @p moving crossed the endpoint at @p crossed on @p axis.
+         */
+        void onCrossing(const Endpoint& moving, const Endpoint& crossed, bool movingUp);
+
+        void addPair(ProxyId first, ProxyId second);
+        void removePair(ProxyId first, ProxyId second);
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename MovableShape>
+    void SweepAndPrune::moveTo(ProxyId proxy, MovableShape& shape, const Vector2& newPos)
+    {
+        shape.moveTo(newPos);
+        update(proxy, shape.bounds());
+    }
+
+    template <typename MovableShape>
+    void SweepAndPrune::moveWith(ProxyId proxy, MovableShape& shape, const Vector2& changePos)
+    {
+        shape.moveWith(changePos);
+        update(proxy, shape.bounds());
+    }
+}
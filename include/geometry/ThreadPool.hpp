@@ -0,0 +1,175 @@
+/**
+ * @file ThreadPool.hpp
+ * 
+ * @brief A file that contains a work-stealing thread pool for the batch queries.
+ * 
+ * Every worker owns a queue of tasks. It takes the newest task from its own queue and, when that
+ * is empty, steals the oldest task of another worker, so uneven chunks of work even out without a
+ * central queue that every thread fights over.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geometry {
+    class ThreadPool final {
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        /**
+         * @brief Starts the workers.
+         * 
+         * @param threadCount The number of threads that run tasks, including the thread that calls
+         * @c parallelFor(). Defaults to the number of hardware threads.
+         */
+        explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator =(const ThreadPool&) = delete;
+
+        /**
+         * @brief Stops and joins the workers, the queued tasks are still run.
+         */
+        ~ThreadPool();
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        /**
+         * @brief Returns the number of threads that run tasks, which is also the number of slots.
+         */
+        std::size_t getThreadCount() const;
+
+        /**
+         * @brief Splits [0, count) into chunks of at most @p grainSize indices and runs @p body on
+         * every chunk, returning when all of them are done.
+         * 
+         * The calling thread runs chunks too while it waits. @p body is called as body(begin, end, slot),
+         * where @p slot is smaller than @c getThreadCount() and is never shared by two chunks running
+         * at the same time, so it can index per-thread buffers. Only one thread outside the pool may
+         * call this at a time.
+         * 
+         * @throws Rethrows the first exception thrown by @p body, after every chunk has finished.
+         */
+        template <typename Body>
+        void parallelFor(std::size_t count, std::size_t grainSize, Body&& body);
+
+        // ==============================
+        //      Private types
+        // ==============================
+    private:
+        using Task = std::function<void(std::size_t slot)>;
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+
+        std::mutex sleepMutex;
+        std::condition_variable wakeUp;
+        std::size_t queuedTasks;
+        bool stopping;
+
+        std::size_t nextQueue;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void push(Task task);
+
+        /**
+         * Runs one task, taken from the own queue of @p slot or stolen from another queue.
+         * 
+         * @returns false if every queue was empty.
+         */
+        bool runOne(std::size_t slot);
+
+        void workerLoop(std::size_t slot);
+    };
+
+    // ==============================
+    //      Template definitions
+    // ==============================
+
+    template <typename Body>
+    void ThreadPool::parallelFor(std::size_t count, std::size_t grainSize, Body&& body)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        grainSize = std::max<std::size_t>(grainSize, 1);
+        const std::size_t chunks = (count + grainSize - 1) / grainSize;
+        const std::size_t callerSlot = workers.size();
+
+        if (chunks == 1 || workers.empty())
+        {
+            body(std::size_t(0), count, callerSlot);
+            return;
+        }
+
+        std::atomic<std::size_t> remaining(chunks);
+        std::exception_ptr failure;
+        std::mutex failureMutex;
+
+        for (std::size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            const std::size_t begin = chunk * grainSize;
+            const std::size_t end = std::min(begin + grainSize, count);
+
+            push([&body, &remaining, &failure, &failureMutex, begin, end](std::size_t slot) {
+                try
+                {
+                    body(begin, end, slot);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(failureMutex);
+                    if (!failure)
+                    {
+                        failure = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        while (remaining.load(std::memory_order_acquire) != 0)
+        {
+            if (!runOne(callerSlot))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file Triangle.hpp
+ * 
+ * @brief This file contains a class representing a triangle.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <array>
+
+#include "geometry/Vector2.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Shape.hpp"
+#include "geometry/Movable.hpp"
+
+namespace geometry {
+    /**
+     * @brief The barycentric coordinates of a point, the weights of the first, second and third vertex of a triangle.
+     */
+    struct Barycentric {
+        float u;
+        float v;
+        float w;
+    };
+
+    class Triangle : public Shape, public Movable {
+        // ==============================
+        //      Constructors and destructor
+        // ==============================
+    public:
+        Triangle(Vector2 firstVertex, Vector2 secondVertex, Vector2 thirdVertex);
+
+        virtual ~Triangle() = default;
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        double area() const override;
+        double perimeter() const override;
+
+        /**
+         * @brief Returns the centroid of the triangle.
+         */
+        Vector2 center() const override;
+        Rect bounds() const override;
+        Vector2 support(const Vector2& direction) const override;
+
+        void moveTo(const Vector2& newPos) override;
+        void moveWith(const Vector2& changePos) override;
+
+        /**
+         * @brief Computes the barycentric coordinates of @p point, they sum to 1.
+         * 
+         * The coordinates are not finite for a degenerate triangle.
+         */
+        Barycentric barycentric(const Vector2& point) const;
+
+        /**
+         * @brief Checks if @p point is inside the triangle or on its boundary.
+         */
+        bool contains(const Vector2& point) const;
+
+        /**
+         * @brief Checks if the two triangles overlap, triangles that only touch count as overlapping.
+         */
+        bool overlaps(const Triangle& other) const;
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        const std::array<Vector2, 3>& getVertices() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        std::array<Vector2, 3> vertices;
+    };
+}
@@ -0,0 +1,128 @@
+/**
+ * @file TriangleArray.hpp
+ * 
+ * @brief A file that contains a structure-of-arrays container of triangles with batch kernels.
+ * 
+ * Every vertex coordinate has its own aligned buffer, so the kernels load the same coordinate of
+ * @c internal::simd::WIDTH triangles at once and test them all against a point or a triangle.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Triangle.hpp"
+#include "geometry/Vector2Array.hpp"
+#include "geometry/internal/AlignedAllocator.hpp"
+#include "geometry/internal/simd.hpp"
+
+namespace geometry {
+    class TriangleArray final {
+
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using Buffer = std::vector<float, internal::AlignedAllocator<float, internal::simd::ALIGNMENT>>;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        TriangleArray() = default;
+        TriangleArray(const std::vector<Triangle>& triangles);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        std::size_t size() const;
+        bool empty() const;
+        Triangle get(std::size_t index) const;
+
+        /**
+         * @brief Computes the barycentric coordinates of every point in the triangle at the same position.
+         * 
+         * @param points One point per triangle.
+         * @param u Receives the weights of the first vertices, resized to size().
+         * @param v Receives the weights of the second vertices, resized to size().
+         * @param w Receives the weights of the third vertices, resized to size().
+         * 
+         * @throws std::invalid_argument if @p points and the triangles have different sizes.
+         */
+        void barycentric(const Vector2Array& points, std::vector<float>& u, std::vector<float>& v, std::vector<float>& w) const;
+
+        /**
+         * @brief Computes the barycentric coordinates of every point of @p points in a single triangle.
+         * 
+         * @param u Receives the weights of the first vertex, resized to the number of points.
+         * @param v Receives the weights of the second vertex, resized to the number of points.
+         * @param w Receives the weights of the third vertex, resized to the number of points.
+         */
+        static void barycentric(const Triangle& triangle, const Vector2Array& points, std::vector<float>& u, std::vector<float>& v, std::vector<float>& w);
+
+        /**
+         * @brief Checks if every point is inside the triangle at the same position, boundaries included.
+         * 
+         * @param results Receives 1 for the points inside their triangle and 0 for the others, resized to size().
+         * 
+         * @throws std::invalid_argument if @p points and the triangles have different sizes.
+         */
+        void contains(const Vector2Array& points, std::vector<std::uint8_t>& results) const;
+
+        /**
+         * @brief Finds every triangle that contains @p point, the picking query.
+         * 
+         * @param hits Receives the indices of the triangles in increasing order, it is cleared first.
+         * 
+         * @returns The number of triangles found.
+         */
+        std::size_t findContaining(const Vector2& point, std::vector<std::uint32_t>& hits) const;
+
+        /**
+         * @brief Finds every triangle that overlaps @p triangle, touching ones included.
+         * 
+         * @param hits Receives the indices of the triangles in increasing order, it is cleared first.
+         * 
+         * @returns The number of triangles found.
+         */
+        std::size_t findOverlapping(const Triangle& triangle, std::vector<std::uint32_t>& hits) const;
+
+        // Object modifier methods
+
+        void reserve(std::size_t capacity);
+        void clear();
+        void push_back(const Triangle& triangle);
+        TriangleArray& set(std::size_t index, const Triangle& triangle);
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        /**
+         * @brief Direct access to the coordinate buffers of the vertex @p vertex (0, 1 or 2), aligned to @c internal::simd::ALIGNMENT.
+         */
+        const float* xData(std::size_t vertex) const;
+        const float* yData(std::size_t vertex) const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Buffer xs[3];
+        Buffer ys[3];
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void checkSameSize(const Vector2Array& points) const;
+    };
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Triangulator.hpp
+ * 
+ * @brief A file that contains the triangulation of simple polygons into index buffers.
+ * 
+ * Small polygons are ear clipped, which is the fastest method for a few dozen vertices. Larger
+ * ones are cut into y-monotone pieces by a sweep line and every piece is triangulated in linear
+ * time, which is O(n log n) overall.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/ThreadPool.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry {
+    class Triangulator final {
+
+        // ==============================
+        //      Constants
+        // ==============================
+    public:
+        /**
+         * @brief The largest number of vertices triangulated by ear clipping.
+         */
+        static constexpr std::size_t EAR_CLIPPING_LIMIT = 64;
+
+        // ==============================
+        //      Triangulation
+        // ==============================
+    public:
+        /**
+         * @brief Triangulates a simple polygon, given in either orientation.
+         * 
+         * @param vertices The vertices of the polygon, in order.
+         * @param count The number of vertices, at least 3.
+         * @param indices Receives three indices into @p vertices per triangle, every triangle in
+         * counter-clockwise order. It is cleared first.
+         * 
+         * @throws std::runtime_error If the polygon is not simple.
+         * 
+         * @returns The number of triangles, count - 2 for a simple polygon.
+         */
+        static std::size_t triangulate(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices);
+
+        /**
+         * @brief Same as @c triangulate(), always by ear clipping, in O(n^2).
+         */
+        static std::size_t earClipping(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices);
+
+        /**
+         * @brief Same as @c triangulate(), always by monotone partition, in O(n log n).
+         */
+        static std::size_t monotonePartition(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices);
+
+        /**
+         * @brief Triangulates many polygons, spread over the threads of @p pool.
+         * 
+         * @param indices Receives one index buffer per polygon, resized to the number of polygons.
+         * 
+         * @throws std::runtime_error If one of the polygons is not simple.
+         */
+        static void triangulateAll(const std::vector<const Polygon*>& polygons, std::vector<std::vector<std::uint32_t>>& indices, ThreadPool& pool);
+    };
+}
@@ -9,10 +9,23 @@
 
 #pragma once
 
-#include <optional>
+#include <type_traits>
+
+#include "geometry/Fixed.hpp"
+#include "geometry/ScalarTraits.hpp"
+#include "geometry/utils.hpp"
+#include "geometry/functions.hpp"
 
 namespace geometry {
-    struct Vector2 final {
+    /**
+     * @brief A 2D vector with coordinates of type @p T.
+     * 
+     * The class is explicitly instantiated for @c float (@c Vector2, the type used by the shapes),
+     * @c double (@c Vector2d) and @c Fixed (@c Vector2fx, for deterministic simulations).
+     * The tolerance of the comparisons and the math functions come from @c ScalarTraits<T>.
+     */
+    template <typename T>
+    struct BasicVector2 final {
 
         // ==============================
         //      Public members
@@ -22,24 +35,23 @@ namespace geometry {
          * Coordinates of a 2D vector.
          * The coordinates are relative to the top-left corner of the screen.
          */
-        float x, y; 
+        T x, y; 
 
         // ==============================
         //      Constructors and Destructor
         // ==============================
     public:
-        Vector2(float x = 0.0f, float y = 0.0f);
-        
         /**
-         * @brief The copy constructor of the Vector2 class.
+         * @brief Constructs a vector from its coordinates.
          * 
-         * This method constructs a @c Vector2 object from another @c Vector2 source object.
+         * Copying, assignment and destruction are left to the compiler, so the vector stays
+         * trivially copyable and can be memcpy-ed or passed around in registers.
+         * Use @c CachedVector2 when the memoized lenght and angle are needed.
          * 
-         * @param src The reference source @c Vector2 object. 
+         * @param x The x coordinate.
+         * @param y The y coordinate.
          */
-        Vector2(const Vector2& src);
-
-        ~Vector2();
+        constexpr BasicVector2(T x = T(0), T y = T(0));
 
         // ==============================
         //      Public methods
@@ -50,27 +62,27 @@ namespace geometry {
         /**
          * @brief Returns the magnitude of the vector. 
          * 
-         * @returns The magnitude of the vector as a float.
+         * @returns The magnitude of the vector as a @c T.
          */
-        float lenght() const;
+        T lenght() const;
 
         /**
          * @brief Returns the sin of the angle between the current object vector and OX.
          * 
-         * @returns The value of the sin of the angle between the current object vector and OX as a float.
+         * @returns The value of the sin of the angle between the current object vector and OX as a @c T.
          * 
          * @throws std::runtime_error() if the vector is (0, 0)
          */
-        float sinTheta() const;
+        T sinTheta() const;
 
         /**
          * @brief Returns the cos of the angle between the current object vector and OX.
          * 
-         * @returns The value of the sin of the angle between the current object vector and OX as a float.
+         * @returns The value of the sin of the angle between the current object vector and OX as a @c T.
          * 
          *  @throws std::runtime_error() if the vector is (0, 0)
          */
-        float cosTheta() const;
+        T cosTheta() const;
 
         /**
          * @brief Calculates the dot product of this vector and another vector.
@@ -82,9 +94,9 @@ namespace geometry {
          * 
          * @param other The other vector to compute the dot product with.
          * 
-         * @returns The dot product as a float.
+         * @returns The dot product as a @c T.
          */
-        float dot(const Vector2& other) const;
+        constexpr T dot(const BasicVector2& other) const;
 
         /**
          * @brief Calculates the angle between this vector and another.
@@ -93,11 +105,11 @@ namespace geometry {
          * 
          * @param other The other vector to compute the angle from.
          * 
-         * @returns The value of the angle in radians as a float.
+         * @returns The value of the angle in radians as a @c T.
          * 
          * @throws std::runtime_error if any of the two vectors are null vector (0, 0)
          */
-        float angleBetween(const Vector2& other);
+        T angleBetween(const BasicVector2& other);
 
         /**
          * @brief Returns a normalized version of this vector.
@@ -106,7 +118,7 @@ namespace geometry {
          * 
          * @returns The current vector normalized returned as a @c Vector2 object
          */
-        Vector2 normalized() const;
+        BasicVector2 normalized() const;
 
         /**
          * @brief Returns a vector that is rotated  with an angle.
@@ -118,7 +130,7 @@ namespace geometry {
          * 
          * @returns The result of the rotation as a @c Vector2 object.
          */
-        Vector2 rotatedBy(float thetaRadians) const;
+        BasicVector2 rotatedBy(T thetaRadians) const;
 
         /**
          *  @brief Returns a scaled version of the current instance object
@@ -130,13 +142,13 @@ namespace geometry {
          * 
          * @returns A scaled version of the current vector.
          */
-        Vector2 scaledBy(float factor) const;
+        constexpr BasicVector2 scaledBy(T factor) const;
 
         /**
          * @brief Checks for equality between two vectors.
          * 
          * Two vectors are equal if they point to the same coordinates.
-         * The equality of floats is made with an epsilon error value of 1e-6.
+         * The equality of the coordinates is checked with the epsilon of @c ScalarTraits<T>.
          * This method doesn't modify the internal state of the current instance object.
          * 
          * @param other The vector that will be checked for equality with the current instance object.
@@ -144,19 +156,19 @@ namespace geometry {
          * @return true If the x and y of the vectors are the same.
          * @return false If the x and y of the vectors are not equal.
          */
-        bool isEqual(const Vector2& other) const;
+        constexpr bool isEqual(const BasicVector2& other) const;
         
         /**
          * @brief Checks if the magnitude of the current instance vector is less than the magnitude of the given parameter vector.
          * 
          * @param other The vector that will be compared by lenght with the current instance object.
          */
-        bool isLessThan(const Vector2& other) const;
+        bool isLessThan(const BasicVector2& other) const;
 
         /**
          * @brief Checks if the magnitude of the current instance vector is greater than the magnitude of the given parameter vector.
          */
-        bool isGreaterThan(const Vector2& other) const;
+        bool isGreaterThan(const BasicVector2& other) const;
 
         /**
          * @brief Checks if the current instance object is the null vector.
@@ -164,7 +176,7 @@ namespace geometry {
          * @return bool true If the current instance vector is null (0, 0).
          * @return bool false If any coordinate of the current instance vector is not 0.
          */
-        bool isNull() const;
+        constexpr bool isNull() const;
 
         // Object modifier methods
 
@@ -178,7 +190,7 @@ namespace geometry {
          * 
          * @returns Vector2& A refference to the current object.
          */
-        Vector2& moveTo(const float x,const float y);
+        constexpr BasicVector2& moveTo(const T x,const T y);
 
         /**
          * @brief Normalizes the current vector.
@@ -187,7 +199,7 @@ namespace geometry {
          * 
          * @returns Vector2& A refference to the current object.
          */
-        Vector2& normalize();
+        BasicVector2& normalize();
 
         /**
          * @brief Rotates the current vector.
@@ -198,7 +210,7 @@ namespace geometry {
          * 
          * @returns Vector2& A reference to the normalized object.
          */
-        Vector2& rotateBy(float angleRadians);
+        BasicVector2& rotateBy(T angleRadians);
 
         /**
          * @brief Scales the current vector by a given factor.
@@ -210,7 +222,7 @@ namespace geometry {
          * 
          * @returns Vector2& A reference to the scaled vector.
          */
-        Vector2& scaleBy(float scalar);
+        constexpr BasicVector2& scaleBy(T scalar);
 
         /**
          * @brief Adds a vector to the current vector.
@@ -221,7 +233,7 @@ namespace geometry {
          * 
          * @returns Vector2& A reference to the modified current object.
          */
-        Vector2& add(const Vector2& other);
+        constexpr BasicVector2& add(const BasicVector2& other);
 
         /**
          * @brief Subtracts a vector from the current vector
@@ -232,14 +244,7 @@ namespace geometry {
          * 
          * @returns Vector2& A reference to the modified current object.
          */
-        Vector2& subtract(const Vector2& other);
-
-        /**
-         * @brief Computes the cache fields that are not memoized.
-         * 
-         * @returns Vector2& A refference to the current object.
-         */
-        Vector2& precompute();
+        constexpr BasicVector2& subtract(const BasicVector2& other);
 
         // ==============================
         //      Operators
@@ -257,7 +262,7 @@ namespace geometry {
          * 
          * @see isEqual() For more details about the equality check.
          */
-        bool operator ==(const Vector2& other) const;
+        constexpr bool operator ==(const BasicVector2& other) const;
 
         /**
          * @brief Checks for inequality between two vectors.
@@ -270,7 +275,7 @@ namespace geometry {
          * 
          * @see isEqual() For more details about the equality check.
          */
-        bool operator !=(const Vector2& other) const;
+        constexpr bool operator !=(const BasicVector2& other) const;
 
         /**
          * @brief Compares two vectors by lenght.
@@ -281,7 +286,7 @@ namespace geometry {
          * @return true If the first vector lenght is smaller.
          * @return false Otherwise. 
          */
-        bool operator <(const Vector2& other) const;
+        bool operator <(const BasicVector2& other) const;
         
         /**
          * @brief Compares two vectors by lenght.
@@ -292,7 +297,7 @@ namespace geometry {
          * @return true If the first vector lenght is greater.
          * @return false Otherwise.  
          */
-        bool operator >(const Vector2& other) const;
+        bool operator >(const BasicVector2& other) const;
 
         /**
          * @brief Compares two vectors by lenght.
@@ -302,7 +307,7 @@ namespace geometry {
          * @return true If the first vector lenght is less than or equal.
          * @return false Otherwise.  
          */
-        bool operator <=(const Vector2& other) const;
+        bool operator <=(const BasicVector2& other) const;
 
         /**
          * @brief Compares two vectors by lenght.
@@ -312,10 +317,10 @@ namespace geometry {
          * @return true If the first vector lenght is greater than or equal.
          * @return false Otherwise.  
          */
-        bool operator >=(const Vector2& other) const;
+        bool operator >=(const BasicVector2& other) const;
 
-        Vector2 operator -() const;
-        Vector2 operator +() const;
+        constexpr BasicVector2 operator -() const;
+        constexpr BasicVector2 operator +() const;
 
         /**
          * @brief Adds two vectors geometrically.
@@ -327,7 +332,7 @@ namespace geometry {
          * @param other The vector to perform the addition with.
          * @returns A new Vector2 object that represents the combined vectors.
          */
-        Vector2 operator +(const Vector2& other) const;
+        constexpr BasicVector2 operator +(const BasicVector2& other) const;
 
         /**
          * @brief Subtracts a vector from another.
@@ -339,7 +344,7 @@ namespace geometry {
          * @param other The vector to perform the subtraction with.
          * @returns A new Vector2 object that represents the difference vector.
          */
-        Vector2 operator -(const Vector2& other) const;
+        constexpr BasicVector2 operator -(const BasicVector2& other) const;
 
         /**
          * @brief Multiplies a vector with a scalar value.
@@ -352,36 +357,182 @@ namespace geometry {
          * @returns A new Vector2 object that represents the scaled vector.
          * 
          */
-        Vector2 operator *(const float scalar) const;
-        Vector2 operator /(const float scalar) const;
-        
-        Vector2& operator =(const Vector2& src);
-        Vector2& operator +=(const Vector2& other);
-        Vector2& operator -=(const Vector2& other);
-        Vector2& operator *=(const float scalar);
-        Vector2& operator /=(const float scalar);
-
-    public:
-
-
-        // ==============================
-        //      Private members
-        // ==============================
-    private:
-        struct Cache {
-            using OptionalFloat = std::optional<float>;
-            mutable OptionalFloat lenght;
-            mutable OptionalFloat sinTheta;
-            mutable OptionalFloat cosTheta;
-
-            Cache& invalidate()
-            {
-                lenght.reset();
-                sinTheta.reset();
-                cosTheta.reset();
-                return *this;
-            }
-        } mutable cache;
+        constexpr BasicVector2 operator *(const T scalar) const;
+        constexpr BasicVector2 operator /(const T scalar) const;
         
+        constexpr BasicVector2& operator +=(const BasicVector2& other);
+        constexpr BasicVector2& operator -=(const BasicVector2& other);
+        constexpr BasicVector2& operator *=(const T scalar);
+        constexpr BasicVector2& operator /=(const T scalar);
     };
+
+    using Vector2 = BasicVector2<float>;
+    using Vector2d = BasicVector2<double>;
+    using Vector2fx = BasicVector2<Fixed>;
+
+    static_assert(sizeof(Vector2) == 2 * sizeof(float), "Vector2 must stay as compact as two floats");
+    static_assert(sizeof(Vector2fx) == 2 * sizeof(Fixed::Raw), "Vector2fx must stay as compact as two raw fixed point values");
+    static_assert(std::is_trivially_copyable<Vector2>::value, "Vector2 must stay trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector2d>::value, "Vector2d must stay trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector2fx>::value, "Vector2fx must stay trivially copyable");
+
+    // The non-constexpr methods are defined in Vector2.cpp for these types only.
+    extern template struct BasicVector2<float>;
+    extern template struct BasicVector2<double>;
+    extern template struct BasicVector2<Fixed>;
+
+    // ==============================
+    //      Inline definitions
+    // ==============================
+
+    template <typename T>
+    constexpr BasicVector2<T>::BasicVector2(T x, T y)
+        : x(x), y(y)
+    {
+
+    }
+
+    template <typename T>
+    constexpr T BasicVector2<T>::dot(const BasicVector2& other) const
+    {
+        return this->x * other.x + this->y * other.y;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::scaledBy(T scalar) const
+    {
+        return BasicVector2(scalar * x, scalar * y);
+    }
+
+    template <typename T>
+    constexpr bool BasicVector2<T>::isEqual(const BasicVector2& other) const
+    {
+        return scalarEq(this->x, other.x) && scalarEq(this->y, other.y);
+    }
+
+    template <typename T>
+    constexpr bool BasicVector2<T>::isNull() const
+    {
+        return (abs(x) <= ScalarTraits<T>::epsilon()) && (abs(y) <= ScalarTraits<T>::epsilon());
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::moveTo(const T x, const T y)
+    {
+        this->x = x;
+        this->y = y;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::scaleBy(T scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::add(const BasicVector2& other)
+    {
+        this->x += other.x;
+        this->y += other.y;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::subtract(const BasicVector2& other)
+    {
+        this->x -= other.x;
+        this->y -= other.y;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr bool BasicVector2<T>::operator ==(const BasicVector2& other) const
+    {
+        return this->isEqual(other);
+    }
+
+    template <typename T>
+    constexpr bool BasicVector2<T>::operator !=(const BasicVector2& other) const
+    {
+        return !this->isEqual(other);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator -() const
+    {
+        return *this * T(-1);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator +() const
+    {
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator +(const BasicVector2& other) const
+    {
+        return BasicVector2(this->x + other.x, this->y + other.y);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator -(const BasicVector2& other) const
+    {
+        return BasicVector2(this->x - other.x, this->y - other.y);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator *(const T scalar) const
+    {
+        return BasicVector2(this->x * scalar, this->y * scalar);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T> BasicVector2<T>::operator /(const T scalar) const
+    {
+        return BasicVector2(this->x / scalar, this->y / scalar);
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::operator +=(const BasicVector2& other)
+    {
+        this->x += other.x;
+        this->y += other.y;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::operator -=(const BasicVector2& other)
+    {
+        this->x -= other.x;
+        this->y -= other.y;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::operator *=(const T scalar)
+    {
+        this->x *= scalar;
+        this->y *= scalar;
+
+        return *this;
+    }
+
+    template <typename T>
+    constexpr BasicVector2<T>& BasicVector2<T>::operator /=(const T scalar)
+    {
+        this->x /= scalar;
+        this->y /= scalar;
+
+        return *this;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * @file Vector2Array.hpp
+ * 
+ * @brief A file that contains a structure-of-arrays container of 2D vectors with vectorized bulk operations.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/Vector2.hpp"
+#include "geometry/internal/AlignedAllocator.hpp"
+#include "geometry/internal/simd.hpp"
+
+namespace geometry {
+    class Vector2Array final {
+        
+        // ==============================
+        //      Types
+        // ==============================
+    public:
+        using Buffer = std::vector<float, internal::AlignedAllocator<float, internal::simd::ALIGNMENT>>;
+
+        // ==============================
+        //      Constructors
+        // ==============================
+    public:
+        Vector2Array() = default;
+
+        /**
+         * @brief Constructs an array of @p size null vectors.
+         */
+        explicit Vector2Array(std::size_t size);
+
+        /**
+         * @brief Constructs the array by splitting the coordinates of @p vectors into the x and y buffers.
+         * 
+         * @param vectors The vectors in array-of-structures layout.
+         */
+        Vector2Array(const std::vector<Vector2>& vectors);
+
+        // ==============================
+        //      Public methods
+        // ==============================
+    public:
+        // Const methods
+
+        std::size_t size() const;
+        bool empty() const;
+
+        /**
+         * @brief Returns the vector at position @p index.
+         */
+        Vector2 get(std::size_t index) const;
+
+        /**
+         * @brief Gathers the x and y buffers back into an array of @c Vector2 objects.
+         * 
+         * @returns The vectors in array-of-structures layout.
+         */
+        std::vector<Vector2> toVector() const;
+
+        /**
+         * @brief Computes the dot product of every vector with the vector at the same position in @p other.
+         * 
+         * @param other An array of the same size.
+         * @param out Receives one dot product per vector, resized to size().
+         * 
+         * @throws std::invalid_argument if the two arrays have different sizes.
+         */
+        void dot(const Vector2Array& other, std::vector<float>& out) const;
+
+        /**
+         * @brief Computes the magnitude of every vector.
+         * 
+         * @param out Receives one lenght per vector, resized to size().
+         */
+        void lenght(std::vector<float>& out) const;
+
+        // Object modifier methods
+
+        void reserve(std::size_t capacity);
+        void resize(std::size_t size);
+        void clear();
+        void push_back(const Vector2& vector);
+
+        /**
+         * @brief Overwrites the vector at position @p index.
+         */
+        Vector2Array& set(std::size_t index, const Vector2& vector);
+
+        /**
+         * @brief Adds the vector at the same position in @p other to every vector.
+         * 
+         * @throws std::invalid_argument if the two arrays have different sizes.
+         */
+        Vector2Array& add(const Vector2Array& other);
+
+        /**
+         * @brief Adds the same @p offset to every vector.
+         */
+        Vector2Array& add(const Vector2& offset);
+
+        /**
+         * @brief Subtracts the vector at the same position in @p other from every vector.
+         * 
+         * @throws std::invalid_argument if the two arrays have different sizes.
+         */
+        Vector2Array& subtract(const Vector2Array& other);
+
+        /**
+         * @brief Subtracts the same @p offset from every vector.
+         */
+        Vector2Array& subtract(const Vector2& offset);
+
+        /**
+         * @brief Multiplies every vector by @p scalar.
+         */
+        Vector2Array& scaleBy(float scalar);
+
+        /**
+         * @brief Normalizes every vector, null vectors are left unchanged like in @c Vector2::normalize().
+         */
+        Vector2Array& normalize();
+
+        /**
+         * @brief Rotates every vector counterclockwise by the same angle.
+         * 
+         * The sin and cos of the angle are computed once for the whole array.
+         * 
+         * @param angleRadians The angle of the rotation, in radians.
+         */
+        Vector2Array& rotateBy(float angleRadians);
+
+        /**
+         * @brief Moves every vector towards the vector at the same position in @p target.
+         * 
+         * Every vector v becomes v + (target - v) * t.
+         * 
+         * @param target An array of the same size.
+         * @param t The interpolation factor, 0 keeps the current vectors and 1 copies @p target.
+         * 
+         * @throws std::invalid_argument if the two arrays have different sizes.
+         */
+        Vector2Array& lerp(const Vector2Array& target, float t);
+
+        // ==============================
+        //      Getters
+        // ==============================
+    public:
+        /**
+         * @brief Direct access to the x coordinates, aligned to @c internal::simd::ALIGNMENT.
+         */
+        float* xData();
+        const float* xData() const;
+
+        /**
+         * @brief Direct access to the y coordinates, aligned to @c internal::simd::ALIGNMENT.
+         */
+        float* yData();
+        const float* yData() const;
+
+        // ==============================
+        //      Private fields
+        // ==============================
+    private:
+        Buffer xs;
+        Buffer ys;
+
+        // ==============================
+        //      Private methods
+        // ==============================
+    private:
+        void checkSameSize(const Vector2Array& other) const;
+    };
+}
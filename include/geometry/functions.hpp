@@ -5,6 +5,6 @@ namespace geometry {
     template <typename Numerical>
     constexpr Numerical abs(Numerical number)
     {
-        return (number > 0) ? number : -number;
+        return (number > Numerical(0)) ? number : -number;
     }
-}
\ No newline at end of file
+}
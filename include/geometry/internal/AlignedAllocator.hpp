@@ -0,0 +1,56 @@
+/**
+ * @file AlignedAllocator.hpp
+ * 
+ * @brief A standard allocator that hands out memory aligned for the SIMD kernels.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace geometry::internal {
+
+    template <typename T, std::size_t Alignment>
+    struct AlignedAllocator {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+        {
+
+        }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* pointer, std::size_t) noexcept
+        {
+            ::operator delete(pointer, std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        bool operator ==(const AlignedAllocator<U, Alignment>&) const noexcept
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator !=(const AlignedAllocator<U, Alignment>&) const noexcept
+        {
+            return false;
+        }
+    };
+}
@@ -0,0 +1,61 @@
+/**
+ * @file Box.hpp
+ * 
+ * @brief A min/max axis-aligned box used internally by the broadphase structures.
+ * 
+ * @c Rect stores a position and a size, which is the friendlier public representation; the
+ * broadphases compare extents all the time, so they keep the extents themselves.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include "geometry/Rect.hpp"
+#include "geometry/Vector2.hpp"
+
+namespace geometry::internal {
+    struct Box {
+        float minX, minY, maxX, maxY;
+
+        static Box fromRect(const Rect& rect)
+        {
+            const Vector2 position = rect.getPosition();
+            return { position.x, position.y, position.x + rect.getWidth(), position.y + rect.getHeight() };
+        }
+
+        static Box combine(const Box& first, const Box& second)
+        {
+            return { std::min(first.minX, second.minX), std::min(first.minY, second.minY),
+                     std::max(first.maxX, second.maxX), std::max(first.maxY, second.maxY) };
+        }
+
+        Rect toRect() const
+        {
+            return Rect(minX, minY, maxX - minX, maxY - minY);
+        }
+
+        float perimeter() const
+        {
+            return 2.0f * ((maxX - minX) + (maxY - minY));
+        }
+
+        bool overlaps(const Box& other) const
+        {
+            return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+        }
+
+        bool contains(const Box& other) const
+        {
+            return minX <= other.minX && minY <= other.minY && other.maxX <= maxX && other.maxY <= maxY;
+        }
+
+        bool contains(const Vector2& point) const
+        {
+            return minX <= point.x && point.x <= maxX && minY <= point.y && point.y <= maxY;
+        }
+    };
+}
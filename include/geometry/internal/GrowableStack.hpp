@@ -0,0 +1,56 @@
+/**
+ * @file GrowableStack.hpp
+ * 
+ * @brief A stack that lives on the call stack for the usual sizes and only spills to the heap when it outgrows them.
+ * 
+ * Used by the tree traversals so that queries don't allocate.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace geometry::internal {
+    template <typename T, std::size_t InlineCapacity>
+    class GrowableStack final {
+    public:
+        void push(const T& value)
+        {
+            if (count < InlineCapacity)
+            {
+                inlineValues[count] = value;
+            }
+            else
+            {
+                spilled.push_back(value);
+            }
+            count++;
+        }
+
+        T pop()
+        {
+            count--;
+            if (count < InlineCapacity)
+            {
+                return inlineValues[count];
+            }
+            T value = spilled.back();
+            spilled.pop_back();
+            return value;
+        }
+
+        bool empty() const
+        {
+            return count == 0;
+        }
+
+    private:
+        T inlineValues[InlineCapacity];
+        std::vector<T> spilled;
+        std::size_t count = 0;
+    };
+}
@@ -0,0 +1,45 @@
+/**
+ * @file Orientation.hpp
+ *
+ * @brief The orientation and signed area helpers shared by the polygon algorithms.
+ *
+ * Both work in double, where the product of two floats is exact, and so is the product of two
+ * differences of floats of close magnitude. The final subtraction and the sum are still rounded,
+ * so a wrong sign for nearly collinear points is much rarer than in float, but not impossible.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "geometry/Vector2.hpp"
+
+namespace geometry::internal {
+    /**
+     * Positive if @p origin, @p first and @p second turn counter-clockwise, negative if they turn
+     * clockwise and 0 if they are collinear.
+     */
+    inline double cross(const Vector2& origin, const Vector2& first, const Vector2& second)
+    {
+        return (static_cast<double>(first.x) - origin.x) * (static_cast<double>(second.y) - origin.y)
+            - (static_cast<double>(first.y) - origin.y) * (static_cast<double>(second.x) - origin.x);
+    }
+
+    /**
+     * The shoelace sum over the closed contour, twice its area, positive for counter-clockwise order.
+     */
+    inline double doubleSignedArea(const Vector2* vertices, std::size_t count)
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Vector2& current = vertices[i];
+            const Vector2& next = vertices[(i + 1 == count) ? 0 : i + 1];
+            sum += static_cast<double>(current.x) * next.y - static_cast<double>(next.x) * current.y;
+        }
+        return sum;
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file TriangleKernels.hpp
+ * 
+ * @brief The vector kernels shared by @c Triangle and @c TriangleArray, one triangle per lane.
+ * 
+ * They use the same formulas as the scalar methods of @c Triangle, which handle the elements
+ * left over after the last full pack.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include "geometry/internal/simd.hpp"
+
+namespace geometry::internal {
+    struct TrianglePack {
+        simd::Pack x0, y0, x1, y1, x2, y2;
+    };
+
+    /**
+     * Computes the weights of the second and third vertex, the weight of the first one is 1 - v - w.
+     */
+    inline void barycentric(const TrianglePack& triangle, simd::Pack x, simd::Pack y, simd::Pack& v, simd::Pack& w)
+    {
+        const simd::Pack edge0X = triangle.x1 - triangle.x0, edge0Y = triangle.y1 - triangle.y0;
+        const simd::Pack edge1X = triangle.x2 - triangle.x0, edge1Y = triangle.y2 - triangle.y0;
+        const simd::Pack offsetX = x - triangle.x0, offsetY = y - triangle.y0;
+
+        const simd::Pack denominator = edge0X * edge1Y - edge0Y * edge1X;
+        v = (offsetX * edge1Y - offsetY * edge1X) / denominator;
+        w = (edge0X * offsetY - edge0Y * offsetX) / denominator;
+    }
+
+    inline simd::Pack containsMask(const TrianglePack& triangle, simd::Pack x, simd::Pack y)
+    {
+        simd::Pack v, w;
+        barycentric(triangle, x, y, v, w);
+
+        const simd::Pack zero = simd::broadcast(0.0f);
+        const simd::Pack u = simd::broadcast(1.0f) - v - w;
+        return simd::greaterEqual(u, zero) & simd::greaterEqual(v, zero) & simd::greaterEqual(w, zero);
+    }
+
+    inline void projectOnAxis(const TrianglePack& triangle, simd::Pack axisX, simd::Pack axisY, simd::Pack& min, simd::Pack& max)
+    {
+        const simd::Pack p0 = triangle.x0 * axisX + triangle.y0 * axisY;
+        const simd::Pack p1 = triangle.x1 * axisX + triangle.y1 * axisY;
+        const simd::Pack p2 = triangle.x2 * axisX + triangle.y2 * axisY;
+
+        min = simd::min(p0, simd::min(p1, p2));
+        max = simd::max(p0, simd::max(p1, p2));
+    }
+
+    inline simd::Pack separatedOnEdge(const TrianglePack& first, const TrianglePack& second, simd::Pack startX, simd::Pack startY, simd::Pack endX, simd::Pack endY)
+    {
+        const simd::Pack axisX = startY - endY, axisY = endX - startX;
+
+        simd::Pack firstMin, firstMax, secondMin, secondMax;
+        projectOnAxis(first, axisX, axisY, firstMin, firstMax);
+        projectOnAxis(second, axisX, axisY, secondMin, secondMax);
+
+        return simd::lessThan(firstMax, secondMin) | simd::lessThan(secondMax, firstMin);
+    }
+
+    /**
+     * Returns the lanes where one of the six edge normals separates the two triangles.
+     */
+    inline simd::Pack separatedMask(const TrianglePack& first, const TrianglePack& second)
+    {
+        return separatedOnEdge(first, second, first.x0, first.y0, first.x1, first.y1)
+            | separatedOnEdge(first, second, first.x1, first.y1, first.x2, first.y2)
+            | separatedOnEdge(first, second, first.x2, first.y2, first.x0, first.y0)
+            | separatedOnEdge(first, second, second.x0, second.y0, second.x1, second.y1)
+            | separatedOnEdge(first, second, second.x1, second.y1, second.x2, second.y2)
+            | separatedOnEdge(first, second, second.x2, second.y2, second.x0, second.y0);
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * @file UniformGrid.hpp
+ *
+ * @brief A grid of equal cells over a box, used to bucket the edges of polygons.
+ *
+ * An edge is visited in every cell it touches, and in a few neighbours: the walk keeps some slack so
+ * that a point computed on an edge, rounding included, always lands in a cell that lists the edge.
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "geometry/Vector2.hpp"
+
+namespace geometry::internal {
+    struct UniformGrid {
+        float minX, minY, maxX, maxY;
+        std::size_t columns, rows;
+        float columnsPerUnit, rowsPerUnit;
+
+        // The lines between the cells, columns + 1 and rows + 1 of them, from the bounds of the box
+        std::vector<float> columnLines;
+        std::vector<float> rowLines;
+
+        /**
+         * Splits about @p cellCount cells between the columns and the rows, so the cells are about as
+         * wide as they are high.
+         */
+        static void fit(float width, float height, double cellCount, std::size_t& columnCount, std::size_t& rowCount)
+        {
+            cellCount = std::max(cellCount, 1.0);
+            columnCount = rowCount = 1;
+            if (width > 0.0f && height > 0.0f)
+            {
+                columnCount = static_cast<std::size_t>(std::ceil(std::sqrt(cellCount * width / height)));
+                rowCount = static_cast<std::size_t>(std::ceil(std::sqrt(cellCount * height / width)));
+            }
+            else if (width > 0.0f)
+            {
+                columnCount = static_cast<std::size_t>(cellCount);
+            }
+            else if (height > 0.0f)
+            {
+                rowCount = static_cast<std::size_t>(cellCount);
+            }
+            columnCount = std::clamp<std::size_t>(columnCount, 1, static_cast<std::size_t>(cellCount));
+            rowCount = std::clamp<std::size_t>(rowCount, 1, static_cast<std::size_t>(cellCount));
+        }
+
+        void reset(float boxMinX, float boxMinY, float boxMaxX, float boxMaxY, std::size_t columnCount, std::size_t rowCount)
+        {
+            minX = boxMinX;
+            minY = boxMinY;
+            maxX = boxMaxX;
+            maxY = boxMaxY;
+            columns = columnCount;
+            rows = rowCount;
+            columnsPerUnit = (maxX > minX) ? columns / (maxX - minX) : 0.0f;
+            rowsPerUnit = (maxY > minY) ? rows / (maxY - minY) : 0.0f;
+            makeLines(columnLines, minX, maxX, columns);
+            makeLines(rowLines, minY, maxY, rows);
+        }
+
+        std::size_t cellCount() const
+        {
+            return columns * rows;
+        }
+
+        /**
+         * The column of @p x from the spacing of the lines, the one @c forEachCell() uses. It may be
+         * one off next to a line, which the slack of the walk covers.
+         */
+        std::size_t columnIndex(float x) const
+        {
+            return indexOf(x, minX, columnsPerUnit, columns);
+        }
+
+        std::size_t rowIndex(float y) const
+        {
+            return indexOf(y, minY, rowsPerUnit, rows);
+        }
+
+        /**
+         * The column whose lines really hold @p x.
+         */
+        std::size_t columnOf(float x) const
+        {
+            // The cell lines are rounded, the cell is moved so that it really holds x
+            std::size_t column = columnIndex(x);
+            while (column > 0 && x < columnLines[column])
+            {
+                column--;
+            }
+            while (column + 1 < columns && x > columnLines[column + 1])
+            {
+                column++;
+            }
+            return column;
+        }
+
+        std::size_t rowOf(float y) const
+        {
+            std::size_t row = rowIndex(y);
+            while (row > 0 && y < rowLines[row])
+            {
+                row--;
+            }
+            while (row + 1 < rows && y > rowLines[row + 1])
+            {
+                row++;
+            }
+            return row;
+        }
+
+        /**
+         * Calls @p visit with the row-major index of every cell the edge touches, and maybe a few neighbours.
+         */
+        template <typename Visitor>
+        void forEachCell(const Vector2& start, const Vector2& end, Visitor&& visit) const
+        {
+            // The slack covers the rounding of the cell lines and of the clipping below, listing an edge in
+            // a cell it does not touch costs a test but never changes a result
+            const float slackX = 0.01f * (maxX - minX) / columns + 1e-6f * std::max(std::fabs(minX), std::fabs(maxX));
+            const float slackY = 0.01f * (maxY - minY) / rows + 1e-6f * std::max(std::fabs(minY), std::fabs(maxY));
+
+            const Vector2& lower = (start.y < end.y) ? start : end;
+            const Vector2& upper = (start.y < end.y) ? end : start;
+            const float slope = (upper.y > lower.y) ? (upper.x - lower.x) / (upper.y - lower.y) : 0.0f;
+
+            const std::size_t firstRow = rowIndex(lower.y - slackY);
+            const std::size_t lastRow = rowIndex(upper.y + slackY);
+            for (std::size_t row = firstRow; row <= lastRow; row++)
+            {
+                // The part of the edge inside the row, widened by the slack
+                float fromX = std::min(start.x, end.x);
+                float toX = std::max(start.x, end.x);
+                if (upper.y > lower.y)
+                {
+                    const float bottom = std::clamp(rowLines[row] - slackY, lower.y, upper.y);
+                    const float top = std::clamp(rowLines[row + 1] + slackY, lower.y, upper.y);
+                    const float bottomX = lower.x + (bottom - lower.y) * slope;
+                    const float topX = lower.x + (top - lower.y) * slope;
+                    fromX = std::max(fromX, std::min(bottomX, topX));
+                    toX = std::min(toX, std::max(bottomX, topX));
+                }
+
+                const std::size_t firstColumn = columnIndex(fromX - slackX);
+                const std::size_t lastColumn = columnIndex(toX + slackX);
+                for (std::size_t column = firstColumn; column <= lastColumn; column++)
+                {
+                    visit(row * columns + column);
+                }
+            }
+        }
+
+    private:
+        static std::size_t indexOf(float value, float origin, float perUnit, std::size_t count)
+        {
+            const float scaled = (value - origin) * perUnit;
+            if (!(scaled > 0.0f))
+            {
+                return 0;
+            }
+            return std::min(static_cast<std::size_t>(scaled), count - 1);
+        }
+
+        static void makeLines(std::vector<float>& lines, float from, float to, std::size_t count)
+        {
+            lines.resize(count + 1);
+            const float step = (to - from) / count;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                lines[i] = from + step * i;
+            }
+            lines[count] = to;
+        }
+    };
+}
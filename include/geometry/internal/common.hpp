@@ -1,3 +1,4 @@
 #pragma once
 
-const float FLOAT_EPSILON = 1.0e-6f;
\ No newline at end of file
+constexpr float FLOAT_EPSILON = 1.0e-6f;
+constexpr double PI = 3.14159265358979323846;
\ No newline at end of file
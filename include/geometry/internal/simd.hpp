@@ -0,0 +1,194 @@
+/**
+ * @file simd.hpp
+ * 
+ * @brief A thin wrapper over the SIMD float lanes used by the batch kernels.
+ * 
+ * The widest instruction set enabled at compile time is picked (AVX, then SSE2, then a scalar
+ * fallback), so the kernels are written once against @c Pack and @c WIDTH.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cmath>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define GEOMETRY_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define GEOMETRY_SIMD_SSE 1
+#endif
+
+namespace geometry::internal::simd {
+
+    /**
+     * Alignment (in bytes) required by the aligned loads and stores.
+     */
+    constexpr std::size_t ALIGNMENT = 32;
+
+#if defined(GEOMETRY_SIMD_AVX)
+    constexpr std::size_t WIDTH = 8;
+
+    struct Pack { __m256 v; };
+
+    inline Pack load(const float* p) { return { _mm256_load_ps(p) }; }
+    inline Pack loadu(const float* p) { return { _mm256_loadu_ps(p) }; }
+    inline void store(float* p, Pack a) { _mm256_store_ps(p, a.v); }
+    inline void storeu(float* p, Pack a) { _mm256_storeu_ps(p, a.v); }
+    inline Pack broadcast(float value) { return { _mm256_set1_ps(value) }; }
+
+    inline Pack operator +(Pack a, Pack b) { return { _mm256_add_ps(a.v, b.v) }; }
+    inline Pack operator -(Pack a, Pack b) { return { _mm256_sub_ps(a.v, b.v) }; }
+    inline Pack operator *(Pack a, Pack b) { return { _mm256_mul_ps(a.v, b.v) }; }
+    inline Pack operator /(Pack a, Pack b) { return { _mm256_div_ps(a.v, b.v) }; }
+    inline Pack operator &(Pack a, Pack b) { return { _mm256_and_ps(a.v, b.v) }; }
+    inline Pack operator |(Pack a, Pack b) { return { _mm256_or_ps(a.v, b.v) }; }
+
+    inline Pack sqrt(Pack a) { return { _mm256_sqrt_ps(a.v) }; }
+    inline Pack min(Pack a, Pack b) { return { _mm256_min_ps(a.v, b.v) }; }
+    inline Pack max(Pack a, Pack b) { return { _mm256_max_ps(a.v, b.v) }; }
+
+    inline Pack lessThan(Pack a, Pack b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Pack lessEqual(Pack a, Pack b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+    inline Pack greaterThan(Pack a, Pack b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Pack greaterEqual(Pack a, Pack b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+
+    /**
+     * @brief Picks @p ifTrue in the lanes where @p mask is set and @p ifFalse elsewhere.
+     */
+    inline Pack select(Pack mask, Pack ifTrue, Pack ifFalse) { return { _mm256_blendv_ps(ifFalse.v, ifTrue.v, mask.v) }; }
+
+    /**
+     * @brief Packs the sign bit of every lane of a comparison mask into the low bits of an int.
+     */
+    inline int moveMask(Pack mask) { return _mm256_movemask_ps(mask.v); }
+
+    /**
+     * @brief Copies every even lane over the odd lane after it, [x0 y0 x1 y1 ...] becomes [x0 x0 x1 x1 ...].
+     */
+    inline Pack duplicateEven(Pack a) { return { _mm256_moveldup_ps(a.v) }; }
+
+    /**
+     * @brief Copies every odd lane over the even lane before it, [x0 y0 x1 y1 ...] becomes [y0 y0 y1 y1 ...].
+     */
+    inline Pack duplicateOdd(Pack a) { return { _mm256_movehdup_ps(a.v) }; }
+
+#elif defined(GEOMETRY_SIMD_SSE)
+    constexpr std::size_t WIDTH = 4;
+
+    struct Pack { __m128 v; };
+
+    inline Pack load(const float* p) { return { _mm_load_ps(p) }; }
+    inline Pack loadu(const float* p) { return { _mm_loadu_ps(p) }; }
+    inline void store(float* p, Pack a) { _mm_store_ps(p, a.v); }
+    inline void storeu(float* p, Pack a) { _mm_storeu_ps(p, a.v); }
+    inline Pack broadcast(float value) { return { _mm_set1_ps(value) }; }
+
+    inline Pack operator +(Pack a, Pack b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline Pack operator -(Pack a, Pack b) { return { _mm_sub_ps(a.v, b.v) }; }
+    inline Pack operator *(Pack a, Pack b) { return { _mm_mul_ps(a.v, b.v) }; }
+    inline Pack operator /(Pack a, Pack b) { return { _mm_div_ps(a.v, b.v) }; }
+    inline Pack operator &(Pack a, Pack b) { return { _mm_and_ps(a.v, b.v) }; }
+    inline Pack operator |(Pack a, Pack b) { return { _mm_or_ps(a.v, b.v) }; }
+
+    inline Pack sqrt(Pack a) { return { _mm_sqrt_ps(a.v) }; }
+    inline Pack min(Pack a, Pack b) { return { _mm_min_ps(a.v, b.v) }; }
+    inline Pack max(Pack a, Pack b) { return { _mm_max_ps(a.v, b.v) }; }
+
+    inline Pack lessThan(Pack a, Pack b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline Pack lessEqual(Pack a, Pack b) { return { _mm_cmple_ps(a.v, b.v) }; }
+    inline Pack greaterThan(Pack a, Pack b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+    inline Pack greaterEqual(Pack a, Pack b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+
+    inline Pack select(Pack mask, Pack ifTrue, Pack ifFalse)
+    {
+        return { _mm_or_ps(_mm_and_ps(mask.v, ifTrue.v), _mm_andnot_ps(mask.v, ifFalse.v)) };
+    }
+
+    inline int moveMask(Pack mask) { return _mm_movemask_ps(mask.v); }
+
+    inline Pack duplicateEven(Pack a) { return { _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(2, 2, 0, 0)) }; }
+    inline Pack duplicateOdd(Pack a) { return { _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(3, 3, 1, 1)) }; }
+
+#else
+    constexpr std::size_t WIDTH = 1;
+
+    /**
+     * Scalar fallback, a comparison mask is stored as 1.0f (set) or 0.0f (clear).
+     */
+    struct Pack { float v; };
+
+    inline Pack load(const float* p) { return { *p }; }
+    inline Pack loadu(const float* p) { return { *p }; }
+    inline void store(float* p, Pack a) { *p = a.v; }
+    inline void storeu(float* p, Pack a) { *p = a.v; }
+    inline Pack broadcast(float value) { return { value }; }
+
+    inline Pack operator +(Pack a, Pack b) { return { a.v + b.v }; }
+    inline Pack operator -(Pack a, Pack b) { return { a.v - b.v }; }
+    inline Pack operator *(Pack a, Pack b) { return { a.v * b.v }; }
+    inline Pack operator /(Pack a, Pack b) { return { a.v / b.v }; }
+    inline Pack operator &(Pack a, Pack b) { return { (a.v != 0.0f && b.v != 0.0f) ? 1.0f : 0.0f }; }
+    inline Pack operator |(Pack a, Pack b) { return { (a.v != 0.0f || b.v != 0.0f) ? 1.0f : 0.0f }; }
+
+    inline Pack sqrt(Pack a) { return { std::sqrt(a.v) }; }
+    inline Pack min(Pack a, Pack b) { return { (a.v < b.v) ? a.v : b.v }; }
+    inline Pack max(Pack a, Pack b) { return { (a.v > b.v) ? a.v : b.v }; }
+
+    inline Pack lessThan(Pack a, Pack b) { return { (a.v < b.v) ? 1.0f : 0.0f }; }
+    inline Pack lessEqual(Pack a, Pack b) { return { (a.v <= b.v) ? 1.0f : 0.0f }; }
+    inline Pack greaterThan(Pack a, Pack b) { return { (a.v > b.v) ? 1.0f : 0.0f }; }
+    inline Pack greaterEqual(Pack a, Pack b) { return { (a.v >= b.v) ? 1.0f : 0.0f }; }
+
+    inline Pack select(Pack mask, Pack ifTrue, Pack ifFalse) { return (mask.v != 0.0f) ? ifTrue : ifFalse; }
+
+    inline int moveMask(Pack mask) { return (mask.v != 0.0f) ? 1 : 0; }
+
+    // A single lane can't hold an interleaved pair, the kernels that need these check WIDTH first.
+    inline Pack duplicateEven(Pack a) { return a; }
+    inline Pack duplicateOdd(Pack a) { return a; }
+#endif
+
+    /**
+     * @brief Rounds @p count down to a multiple of @c WIDTH, the end of the vectorized part of a loop.
+     */
+    constexpr std::size_t packedEnd(std::size_t count)
+    {
+        return count - count % WIDTH;
+    }
+
+    /**
+     * @brief Returns the index of the lowest set bit of a non-zero @c moveMask() result.
+     */
+    inline unsigned lowestSetLane(unsigned mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    /**
+     * @brief Loads the repeating pattern [first second first second ...] into a pack.
+     */
+    inline Pack broadcastPair(float first, float second)
+    {
+        alignas(ALIGNMENT) float pattern[WIDTH];
+        for (std::size_t i = 0; i < WIDTH; i++)
+        {
+            pattern[i] = (i % 2 == 0) ? first : second;
+        }
+        return load(pattern);
+    }
+}
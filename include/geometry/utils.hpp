@@ -1,6 +1,22 @@
 #pragma once
 
+#include "geometry/internal/common.hpp"
+#include "geometry/functions.hpp"
+#include "geometry/ScalarTraits.hpp"
+
 namespace geometry
 {
-    constexpr bool floatEq(float f1, float f2);
+    /**
+     * @brief Compares two values with the tolerance of their type, see @c ScalarTraits.
+     */
+    template <typename T>
+    constexpr bool scalarEq(T v1, T v2)
+    {
+        return geometry::abs(v1 - v2) < ScalarTraits<T>::epsilon();
+    }
+
+    constexpr bool floatEq(float f1, float f2)
+    {
+        return scalarEq(f1, f2);
+    }
 }
@@ -0,0 +1,137 @@
+/**
+ * @file Affine2.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::Affine2 class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Affine2.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Vector2Array.hpp"
+#include "geometry/internal/common.hpp"
+#include "geometry/internal/simd.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+Affine2 Affine2::rotation(float angleRadians)
+{
+    float sinTheta = std::sin(angleRadians);
+    float cosTheta = std::cos(angleRadians);
+    return Affine2(cosTheta, -sinTheta, 0.0f, sinTheta, cosTheta, 0.0f);
+}
+
+Affine2 Affine2::rotation(float angleRadians, const Vector2& pivot)
+{
+    return translation(-pivot).then(rotation(angleRadians)).then(translation(pivot));
+}
+
+Affine2 Affine2::inverse() const
+{
+    float det = determinant();
+    if (std::fabs(det) < FLOAT_EPSILON)
+    {
+        throw std::runtime_error("Can't invert a singular transform!");
+    }
+
+    float inverseA = d / det;
+    float inverseB = -b / det;
+    float inverseC = -c / det;
+    float inverseD = a / det;
+
+    return Affine2(
+        inverseA, inverseB, -(inverseA * tx + inverseB * ty),
+        inverseC, inverseD, -(inverseC * tx + inverseD * ty)
+    );
+}
+
+void Affine2::apply(Vector2* points, std::size_t count) const
+{
+    // The points are processed as interleaved [x0 y0 x1 y1 ...] floats, so one pack holds WIDTH / 2 points:
+    // [x' y'] = [x x] * [a c] + [y y] * [b d] + [tx ty]
+    float* coordinates = reinterpret_cast<float*>(points);
+    const std::size_t floatCount = 2 * count;
+    std::size_t i = 0;
+
+    if constexpr (simd::WIDTH >= 2)
+    {
+        const std::size_t packed = simd::packedEnd(floatCount);
+        const simd::Pack xColumn = simd::broadcastPair(a, c);
+        const simd::Pack yColumn = simd::broadcastPair(b, d);
+        const simd::Pack offset = simd::broadcastPair(tx, ty);
+
+        for (; i < packed; i += simd::WIDTH)
+        {
+            simd::Pack pair = simd::loadu(coordinates + i);
+            simd::Pack result = simd::duplicateEven(pair) * xColumn + simd::duplicateOdd(pair) * yColumn + offset;
+            simd::storeu(coordinates + i, result);
+        }
+    }
+    for (std::size_t point = i / 2; point < count; point++)
+    {
+        points[point] = apply(points[point]);
+    }
+}
+
+void Affine2::apply(std::vector<Vector2>& points) const
+{
+    apply(points.data(), points.size());
+}
+
+void Affine2::apply(Vector2Array& points) const
+{
+    float* xs = points.xData();
+    float* ys = points.yData();
+    const std::size_t count = points.size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack packA = simd::broadcast(a), packB = simd::broadcast(b), packTx = simd::broadcast(tx);
+    const simd::Pack packC = simd::broadcast(c), packD = simd::broadcast(d), packTy = simd::broadcast(ty);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack x = simd::load(xs + i);
+        simd::Pack y = simd::load(ys + i);
+        simd::store(xs + i, packA * x + packB * y + packTx);
+        simd::store(ys + i, packC * x + packD * y + packTy);
+    }
+    for (; i < count; i++)
+    {
+        float x = xs[i];
+        xs[i] = a * x + b * ys[i] + tx;
+        ys[i] = c * x + d * ys[i] + ty;
+    }
+}
+
+void Affine2::apply(Polygon& polygon) const
+{
+    polygon.transform(*this);
+}
+
+Rect Affine2::apply(const Rect& rect) const
+{
+    // Arvo's method: every output extent is the translation plus, for each matrix entry,
+    // the smaller (or larger) of the entry multiplied with the input minimum and maximum.
+    const float minX = rect.getPosition().x, maxX = minX + rect.getWidth();
+    const float minY = rect.getPosition().y, maxY = minY + rect.getHeight();
+
+    float outMinX = tx + std::fmin(a * minX, a * maxX) + std::fmin(b * minY, b * maxY);
+    float outMaxX = tx + std::fmax(a * minX, a * maxX) + std::fmax(b * minY, b * maxY);
+    float outMinY = ty + std::fmin(c * minX, c * maxX) + std::fmin(d * minY, d * maxY);
+    float outMaxY = ty + std::fmax(c * minX, c * maxX) + std::fmax(d * minY, d * maxY);
+
+    return Rect(outMinX, outMinY, outMaxX - outMinX, outMaxY - outMinY);
+}
+
+Affine2& Affine2::rotate(float angleRadians)
+{
+    *this = then(rotation(angleRadians));
+    return *this;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file CachedVector2.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::CachedVector2 class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/CachedVector2.hpp"
+
+#include <stdexcept>
+
+#include "geometry/internal/common.hpp"
+#include "geometry/utils.hpp"
+
+using namespace geometry;
+
+CachedVector2::CachedVector2(const Vector2& vector)
+    : value(vector)
+{
+
+}
+
+CachedVector2::CachedVector2(float x, float y)
+    : value(x, y)
+{
+
+}
+
+const Vector2& CachedVector2::vector() const
+{
+    return value;
+}
+
+float CachedVector2::lenght() const
+{
+    if (!cache.lenght.has_value())
+    {
+        cache.lenght.emplace(value.lenght());
+    }
+    return cache.lenght.value();
+}
+
+float CachedVector2::sinTheta() const
+{
+    if (floatEq(this->lenght(), 0.0f))
+    {
+        throw std::runtime_error("Can't compute sin of vector with lenght 0!\nUse isNull() method to check for zero lenght vector");
+    }
+
+    if (!cache.sinTheta.has_value())
+    {
+        cache.sinTheta.emplace(value.y / this->lenght());
+    }
+    return cache.sinTheta.value();
+}
+
+float CachedVector2::cosTheta() const
+{
+    if (floatEq(this->lenght(), 0.0f))
+    {
+        throw std::runtime_error("Can't compute cos of vector with lenght 0!\nUse isNull() method to check for zero lenght vector");
+    }
+
+    if (!cache.cosTheta.has_value())
+    {
+        cache.cosTheta.emplace(value.x / this->lenght());
+    }
+    return cache.cosTheta.value();
+}
+
+CachedVector2& CachedVector2::moveTo(const Vector2& vector)
+{
+    value = vector;
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::moveTo(const float x, const float y)
+{
+    value.moveTo(x, y);
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::normalize()
+{
+    float lenght = this->lenght();
+
+    // The direction doesn't change, so the memoized sin and cos stay valid.
+    if (lenght > FLOAT_EPSILON)
+    {
+        value /= lenght;
+        cache.lenght.emplace(1.0f);
+    }
+
+    return *this;
+}
+
+CachedVector2& CachedVector2::rotateBy(float angleRadians)
+{
+    value.rotateBy(angleRadians);
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::scaleBy(float scalar)
+{
+    value.scaleBy(scalar);
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::add(const Vector2& other)
+{
+    value.add(other);
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::subtract(const Vector2& other)
+{
+    value.subtract(other);
+
+    cache.invalidate();
+    return *this;
+}
+
+CachedVector2& CachedVector2::precompute()
+{
+    this->lenght();
+    this->cosTheta();
+    this->sinTheta();
+
+    return *this;
+}
+
+CachedVector2::operator const Vector2&() const
+{
+    return value;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file Circle.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::Circle class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Circle.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "geometry/internal/common.hpp"
+
+using namespace geometry;
+
+Circle::Circle(Vector2 center, float radius)
+    : position(center), radius(0.0f)
+{
+    setRadius(radius);
+}
+
+double Circle::area() const
+{
+    return PI * radius * radius;
+}
+
+double Circle::perimeter() const
+{
+    return 2 * PI * radius;
+}
+
+Vector2 Circle::center() const
+{
+    return position;
+}
+
+Rect Circle::bounds() const
+{
+    return Rect(position.x - radius, position.y - radius, 2 * radius, 2 * radius);
+}
+
+Vector2 Circle::support(const Vector2& direction) const
+{
+    const float lenght = direction.lenght();
+    if (lenght == 0.0f)
+    {
+        return position;
+    }
+
+    return position + direction * (radius / lenght);
+}
+
+void Circle::moveTo(const Vector2& newPos)
+{
+    position = newPos;
+}
+
+void Circle::moveWith(const Vector2& changePos)
+{
+    position += changePos;
+}
+
+bool Circle::contains(const Vector2& point) const
+{
+    const Vector2 offset = point - position;
+    return offset.dot(offset) <= radius * radius;
+}
+
+bool Circle::overlaps(const Circle& other) const
+{
+    const Vector2 offset = other.position - position;
+    const float reach = radius + other.radius;
+    return offset.dot(offset) <= reach * reach;
+}
+
+bool Circle::overlaps(const Rect& rect) const
+{
+    // The point of the rect closest to the center.
+    const Vector2 corner = rect.getPosition();
+    const float closestX = std::clamp(position.x, corner.x, corner.x + rect.getWidth());
+    const float closestY = std::clamp(position.y, corner.y, corner.y + rect.getHeight());
+
+    return contains(Vector2(closestX, closestY));
+}
+
+float Circle::getRadius() const
+{
+    return radius;
+}
+
+Circle& Circle::setRadius(float radius)
+{
+    if (radius < 0.0f)
+    {
+        throw std::invalid_argument("The radius of a circle can not be negative!");
+    }
+
+    this->radius = radius;
+    return *this;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file CircleSet.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::CircleSet class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/CircleSet.hpp"
+
+#include <algorithm>
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    /**
+     * Runs @p packTest on the circles in [begin, size) of @p circles, @c simd::WIDTH at a time, and
+     * @p scalarTest on the ones left over, then calls @p onHit with the index of every hit in
+     * increasing order.
+     */
+    template <typename PackTest, typename ScalarTest, typename HitCallback>
+    void forEachHit(const CircleSet& circles, std::size_t begin, PackTest&& packTest, ScalarTest&& scalarTest, HitCallback&& onHit)
+    {
+        const float* xs = circles.xData();
+        const float* ys = circles.yData();
+        const float* radii = circles.radiusData();
+        const std::size_t count = circles.size();
+
+        std::size_t i = begin;
+        if (count > begin)
+        {
+            const std::size_t packed = begin + simd::packedEnd(count - begin);
+            for (; i < packed; i += simd::WIDTH)
+            {
+                unsigned mask = static_cast<unsigned>(simd::moveMask(packTest(simd::loadu(xs + i), simd::loadu(ys + i), simd::loadu(radii + i))));
+                while (mask != 0)
+                {
+                    onHit(static_cast<std::uint32_t>(i + simd::lowestSetLane(mask)));
+                    mask &= mask - 1;
+                }
+            }
+        }
+        for (; i < count; i++)
+        {
+            if (scalarTest(xs[i], ys[i], radii[i]))
+            {
+                onHit(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    /**
+     * Visits the circles overlapping the circle centered at (x, y) with radius @p radius.
+     */
+    template <typename HitCallback>
+    void forEachOverlap(float x, float y, float radius, const CircleSet& circles, std::size_t begin, HitCallback&& onHit)
+    {
+        const simd::Pack centerX = simd::broadcast(x), centerY = simd::broadcast(y), reach = simd::broadcast(radius);
+
+        forEachHit(circles, begin,
+            [&](simd::Pack xs, simd::Pack ys, simd::Pack radii) {
+                const simd::Pack dx = xs - centerX, dy = ys - centerY, sum = radii + reach;
+                return simd::lessEqual(dx * dx + dy * dy, sum * sum);
+            },
+            [&](float otherX, float otherY, float otherRadius) {
+                const float dx = otherX - x, dy = otherY - y, sum = otherRadius + radius;
+                return dx * dx + dy * dy <= sum * sum;
+            },
+            onHit);
+    }
+}
+
+CircleSet::CircleSet(const std::vector<Circle>& circles)
+{
+    reserve(circles.size());
+    for (const auto& circle : circles)
+    {
+        push_back(circle);
+    }
+}
+
+std::size_t CircleSet::size() const
+{
+    return xs.size();
+}
+
+bool CircleSet::empty() const
+{
+    return xs.empty();
+}
+
+Circle CircleSet::get(std::size_t index) const
+{
+    return Circle(Vector2(xs[index], ys[index]), radii[index]);
+}
+
+std::size_t CircleSet::findOverlapping(const Circle& circle, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    const Vector2 center = circle.center();
+    forEachOverlap(center.x, center.y, circle.getRadius(), *this, 0, [&hits](std::uint32_t index) { hits.push_back(index); });
+
+    return hits.size();
+}
+
+std::size_t CircleSet::findOverlapping(const Rect& rect, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    const Vector2 corner = rect.getPosition();
+    const float minX = corner.x, minY = corner.y;
+    const float maxX = corner.x + rect.getWidth(), maxY = corner.y + rect.getHeight();
+    const simd::Pack packMinX = simd::broadcast(minX), packMinY = simd::broadcast(minY);
+    const simd::Pack packMaxX = simd::broadcast(maxX), packMaxY = simd::broadcast(maxY);
+
+    // The distance from each center to the point of the rect closest to it.
+    forEachHit(*this, 0,
+        [&](simd::Pack xs, simd::Pack ys, simd::Pack radii) {
+            const simd::Pack dx = xs - simd::min(simd::max(xs, packMinX), packMaxX);
+            const simd::Pack dy = ys - simd::min(simd::max(ys, packMinY), packMaxY);
+            return simd::lessEqual(dx * dx + dy * dy, radii * radii);
+        },
+        [&](float x, float y, float radius) {
+            const float dx = x - std::min(std::max(x, minX), maxX);
+            const float dy = y - std::min(std::max(y, minY), maxY);
+            return dx * dx + dy * dy <= radius * radius;
+        },
+        [&hits](std::uint32_t index) { hits.push_back(index); });
+
+    return hits.size();
+}
+
+std::size_t CircleSet::findContaining(const Vector2& point, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    // A point is a circle of radius zero.
+    forEachOverlap(point.x, point.y, 0.0f, *this, 0, [&hits](std::uint32_t index) { hits.push_back(index); });
+
+    return hits.size();
+}
+
+std::size_t CircleSet::findOverlappingPairs(std::vector<IndexPair>& pairs) const
+{
+    pairs.clear();
+
+    for (std::size_t i = 0; i < size(); i++)
+    {
+        const std::uint32_t first = static_cast<std::uint32_t>(i);
+        forEachOverlap(xs[i], ys[i], radii[i], *this, i + 1, [&pairs, first](std::uint32_t second) { pairs.push_back({first, second}); });
+    }
+
+    return pairs.size();
+}
+
+std::size_t CircleSet::findOverlappingPairs(const CircleSet& other, std::vector<IndexPair>& pairs) const
+{
+    pairs.clear();
+
+    for (std::size_t i = 0; i < size(); i++)
+    {
+        const std::uint32_t first = static_cast<std::uint32_t>(i);
+        forEachOverlap(xs[i], ys[i], radii[i], other, 0, [&pairs, first](std::uint32_t second) { pairs.push_back({first, second}); });
+    }
+
+    return pairs.size();
+}
+
+void CircleSet::reserve(std::size_t capacity)
+{
+    xs.reserve(capacity);
+    ys.reserve(capacity);
+    radii.reserve(capacity);
+}
+
+void CircleSet::clear()
+{
+    xs.clear();
+    ys.clear();
+    radii.clear();
+}
+
+void CircleSet::push_back(const Circle& circle)
+{
+    const Vector2 center = circle.center();
+    xs.push_back(center.x);
+    ys.push_back(center.y);
+    radii.push_back(circle.getRadius());
+}
+
+CircleSet& CircleSet::set(std::size_t index, const Circle& circle)
+{
+    const Vector2 center = circle.center();
+    xs[index] = center.x;
+    ys[index] = center.y;
+    radii[index] = circle.getRadius();
+    return *this;
+}
+
+const float* CircleSet::xData() const
+{
+    return xs.data();
+}
+
+const float* CircleSet::yData() const
+{
+    return ys.data();
+}
+
+const float* CircleSet::radiusData() const
+{
+    return radii.data();
+}
@@ -0,0 +1,767 @@
+/**
+ * @file Clipper.cpp
+ *
+ * @brief Implementation of the methods from the @c geometry::Clipper class
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Clipper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "geometry/internal/Box.hpp"
+#include "geometry/internal/Orientation.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    // How a fragment relates to the inside of the other polygon
+    constexpr std::uint8_t INSIDE = 0;
+    constexpr std::uint8_t OUTSIDE = 1;
+    constexpr std::uint8_t SHARED_SAME = 2;
+    constexpr std::uint8_t SHARED_OPPOSITE = 3;
+    constexpr std::uint8_t UNKNOWN = 4;
+
+    // Where a point lies on the boundary of the other polygon
+    constexpr std::uint8_t NO_CONTACT = 0;
+    constexpr std::uint8_t ON_EDGE = 1;
+    constexpr std::uint8_t ON_VERTEX = 2;
+
+    // How many roundings away from the end of an edge a crossing is moved onto it
+    constexpr float SNAP_ROUNDINGS = 4.0f;
+
+    // A few cells per edge at most, more would only list the long edges in more of them
+    constexpr double CELLS_PER_EDGE = 4.0;
+
+    /**
+     * The cross product of the directions of two segments, positive if the second one points left of the first.
+     */
+    double turn(const Vector2& firstStart, const Vector2& firstEnd, const Vector2& secondStart, const Vector2& secondEnd)
+    {
+        return (static_cast<double>(firstEnd.x) - firstStart.x) * (static_cast<double>(secondEnd.y) - secondStart.y)
+            - (static_cast<double>(firstEnd.y) - firstStart.y) * (static_cast<double>(secondEnd.x) - secondStart.x);
+    }
+
+    double dot(const Vector2& firstStart, const Vector2& firstEnd, const Vector2& secondStart, const Vector2& secondEnd)
+    {
+        return (static_cast<double>(firstEnd.x) - firstStart.x) * (static_cast<double>(secondEnd.x) - secondStart.x)
+            + (static_cast<double>(firstEnd.y) - firstStart.y) * (static_cast<double>(secondEnd.y) - secondStart.y);
+    }
+
+    /**
+     * Exact equality, @c Vector2::operator== allows a tolerance, which would not agree with @c lessPoint().
+     */
+    bool samePoint(const Vector2& first, const Vector2& second)
+    {
+        return first.x == second.x && first.y == second.y;
+    }
+
+    bool lessPoint(const Vector2& first, const Vector2& second)
+    {
+        return first.x < second.x || (first.x == second.x && first.y < second.y);
+    }
+
+    /**
+     * The even-odd crossing test, only used for polygons whose boundaries never meet.
+     */
+    bool contains(const std::vector<Vector2>& vertices, const Vector2& point)
+    {
+        bool inside = false;
+        for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+        {
+            const Vector2& a = vertices[i];
+            const Vector2& b = vertices[j];
+            if ((a.y > point.y) != (b.y > point.y))
+            {
+                const double x = a.x + (static_cast<double>(point.y) - a.y) * (static_cast<double>(b.x) - a.x) / (static_cast<double>(b.y) - a.y);
+                if (point.x < x)
+                {
+                    inside = !inside;
+                }
+            }
+        }
+        return inside;
+    }
+
+    /**
+     * One Sutherland-Hodgman pass, keeping the points where sign * (coordinate - boundary) >= 0.
+     */
+    template <int Axis>
+    std::size_t clipPass(const Vector2* input, std::size_t count, float boundary, float sign, Vector2* output)
+    {
+        auto distance = [boundary, sign](const Vector2& point) {
+            return sign * ((Axis == 0 ? point.x : point.y) - boundary);
+        };
+
+        std::size_t written = 0;
+        Vector2 previous = input[count - 1];
+        float previousDistance = distance(previous);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Vector2 current = input[i];
+            const float currentDistance = distance(current);
+            const bool currentInside = currentDistance >= 0.0f;
+
+            if (currentInside != (previousDistance >= 0.0f))
+            {
+                const float t = previousDistance / (previousDistance - currentDistance);
+                Vector2 crossing = previous + (current - previous) * t;
+                // Put the point exactly on the boundary, rounding may leave it a little outside
+                (Axis == 0 ? crossing.x : crossing.y) = boundary;
+                output[written++] = crossing;
+            }
+            output[written] = current;
+            written += currentInside;
+
+            previous = current;
+            previousDistance = currentDistance;
+        }
+        return written;
+    }
+}
+
+void Contours::clear()
+{
+    vertices.clear();
+    offsets.clear();
+}
+
+std::size_t Contours::size() const
+{
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+const Vector2* Contours::contourData(std::size_t contour) const
+{
+    return vertices.data() + offsets[contour];
+}
+
+std::size_t Contours::contourSize(std::size_t contour) const
+{
+    return offsets[contour + 1] - offsets[contour];
+}
+
+double Contours::area() const
+{
+    double sum = 0.0;
+    for (std::size_t contour = 0; contour < size(); contour++)
+    {
+        sum += doubleSignedArea(contourData(contour), contourSize(contour));
+    }
+    return sum / 2.0;
+}
+
+std::size_t Clipper::clip(const Vector2* vertices, std::size_t count, const Rect& rect, std::vector<Vector2>& output)
+{
+    output.clear();
+    if (count < 3)
+    {
+        return 0;
+    }
+
+    const Vector2 minCorner = rect.getPosition();
+    const Vector2 maxCorner = minCorner + Vector2(rect.getWidth(), rect.getHeight());
+
+    // Every pass at most doubles the vertices, the two buffers take turns as input and output
+    output.resize(2 * count);
+    std::size_t size = clipPass<0>(vertices, count, minCorner.x, 1.0f, output.data());
+    if (size != 0)
+    {
+        scratch.resize(2 * size);
+        size = clipPass<0>(output.data(), size, maxCorner.x, -1.0f, scratch.data());
+    }
+    if (size != 0)
+    {
+        output.resize(2 * size);
+        size = clipPass<1>(scratch.data(), size, minCorner.y, 1.0f, output.data());
+    }
+    if (size != 0)
+    {
+        scratch.resize(2 * size);
+        size = clipPass<1>(output.data(), size, maxCorner.y, -1.0f, scratch.data());
+    }
+
+    output.assign(scratch.begin(), scratch.begin() + size);
+    if (size < 3)
+    {
+        output.clear();
+    }
+    return output.size();
+}
+
+std::size_t Clipper::clip(const Polygon& polygon, const Rect& rect, std::vector<Vector2>& output)
+{
+    return clip(polygon.getVertices().data(), polygon.getVertices().size(), rect, output);
+}
+
+std::size_t Clipper::compute(BooleanOperation operation, const Vector2* subject, std::size_t subjectCount,
+    const Vector2* clip, std::size_t clipCount, Contours& output)
+{
+    output.clear();
+
+    loadSide(0, subject, subjectCount);
+    loadSide(1, clip, clipCount);
+    findSplits();
+    splitEdges(0);
+    splitEdges(1);
+    classify(0);
+    classify(1);
+
+    std::uint8_t subjectKept = OUTSIDE;
+    std::uint8_t sharedKept = SHARED_SAME;
+    std::uint8_t clipKept = OUTSIDE;
+    switch (operation)
+    {
+    case BooleanOperation::Union:
+        break;
+    case BooleanOperation::Intersection:
+        subjectKept = INSIDE;
+        clipKept = INSIDE;
+        break;
+    case BooleanOperation::Difference:
+        sharedKept = SHARED_OPPOSITE;
+        clipKept = INSIDE;
+        break;
+    }
+
+    selected.clear();
+    for (const Fragment& fragment : sides[0].fragments)
+    {
+        if (fragment.location == subjectKept || fragment.location == sharedKept)
+        {
+            selected.push_back(fragment);
+        }
+    }
+    for (const Fragment& fragment : sides[1].fragments)
+    {
+        if (fragment.location == clipKept)
+        {
+            selected.push_back(fragment);
+            if (operation == BooleanOperation::Difference)
+            {
+                std::swap(selected.back().start, selected.back().end);
+            }
+        }
+    }
+
+    chain(output);
+    return output.size();
+}
+
+std::size_t Clipper::compute(BooleanOperation operation, const Polygon& subject, const Polygon& clip, Contours& output)
+{
+    return compute(operation, subject.getVertices().data(), subject.getVertices().size(),
+        clip.getVertices().data(), clip.getVertices().size(), output);
+}
+
+void Clipper::loadSide(std::size_t side, const Vector2* vertices, std::size_t count)
+{
+    Side& current = sides[side];
+    current.vertices.clear();
+    current.splits.clear();
+    current.fragments.clear();
+
+    // Repeated vertices would make null edges
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (current.vertices.empty() || !samePoint(current.vertices.back(), vertices[i]))
+        {
+            current.vertices.push_back(vertices[i]);
+        }
+    }
+    while (current.vertices.size() > 1 && samePoint(current.vertices.back(), current.vertices.front()))
+    {
+        current.vertices.pop_back();
+    }
+
+    const double area = current.vertices.size() < 3 ? 0.0 : doubleSignedArea(current.vertices.data(), current.vertices.size());
+    if (area == 0.0)
+    {
+        // Nothing is inside a degenerate polygon, so it is treated as empty
+        current.vertices.clear();
+    }
+    else if (area < 0.0)
+    {
+        std::reverse(current.vertices.begin(), current.vertices.end());
+    }
+    current.contacts.assign(current.vertices.size(), {0, NO_CONTACT});
+    current.collinear.assign(current.vertices.size(), 0);
+}
+
+void Clipper::findSplits()
+{
+    const std::vector<Vector2>& subject = sides[0].vertices;
+    const std::vector<Vector2>& clip = sides[1].vertices;
+    if (subject.empty() || clip.empty())
+    {
+        return;
+    }
+
+    Box bounds[2];
+    double lengthSum = 0.0;
+    for (std::size_t side = 0; side < 2; side++)
+    {
+        const std::vector<Vector2>& vertices = sides[side].vertices;
+        bounds[side] = { vertices[0].x, vertices[0].y, vertices[0].x, vertices[0].y };
+        for (std::size_t i = 0; i < vertices.size(); i++)
+        {
+            const Vector2& current = vertices[i];
+            bounds[side] = Box::combine(bounds[side], { current.x, current.y, current.x, current.y });
+            lengthSum += (vertices[(i + 1) % vertices.size()] - current).lenght();
+        }
+    }
+
+    // Edges can only meet where the bounds of the polygons overlap
+    if (!bounds[0].overlaps(bounds[1]))
+    {
+        return;
+    }
+    const Box box = { std::max(bounds[0].minX, bounds[1].minX), std::max(bounds[0].minY, bounds[1].minY),
+                      std::min(bounds[0].maxX, bounds[1].maxX), std::min(bounds[0].maxY, bounds[1].maxY) };
+
+    // Cells about as large as an average edge, so an edge is listed in a few of them, and never more
+    // than a few cells per edge
+    const std::size_t edgeCount = subject.size() + clip.size();
+    const double edgeLength = lengthSum / edgeCount;
+    const double width = static_cast<double>(box.maxX) - box.minX;
+    const double height = static_cast<double>(box.maxY) - box.minY;
+    double cellCount = CELLS_PER_EDGE * edgeCount;
+    if (edgeLength > 0.0)
+    {
+        cellCount = std::min(cellCount, std::max(width * height, std::max(width, height) * edgeLength) / (edgeLength * edgeLength));
+    }
+
+    std::size_t columnCount, rowCount;
+    UniformGrid::fit(static_cast<float>(width), static_cast<float>(height), cellCount, columnCount, rowCount);
+    grid.reset(box.minX, box.minY, box.maxX, box.maxY, columnCount, rowCount);
+
+    const std::uint32_t subjectCount = static_cast<std::uint32_t>(subject.size());
+    auto forEachEntry = [&](auto&& visit) {
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            const std::vector<Vector2>& vertices = sides[side].vertices;
+            for (std::uint32_t i = 0; i < vertices.size(); i++)
+            {
+                const Vector2& start = vertices[i];
+                const Vector2& end = vertices[(i + 1) % vertices.size()];
+                const Box edgeBox = { std::min(start.x, end.x), std::min(start.y, end.y), std::max(start.x, end.x), std::max(start.y, end.y) };
+                if (edgeBox.overlaps(box))
+                {
+                    const std::uint32_t entry = (side == 0) ? i : subjectCount + i;
+                    grid.forEachCell(start, end, [&](std::size_t cell) {
+                        visit(cell, entry);
+                    });
+                }
+            }
+        }
+    };
+
+    // Two passes: count the edges of every cell, then write them contiguously
+    cellStarts.assign(grid.cellCount() + 1, 0);
+    forEachEntry([this](std::size_t cell, std::uint32_t) {
+        cellStarts[cell + 1]++;
+    });
+    for (std::size_t cell = 0; cell < grid.cellCount(); cell++)
+    {
+        cellStarts[cell + 1] += cellStarts[cell];
+    }
+    cellEdges.resize(cellStarts.back());
+    cellCursors.assign(cellStarts.begin(), cellStarts.end() - 1);
+    forEachEntry([this](std::size_t cell, std::uint32_t entry) {
+        cellEdges[cellCursors[cell]++] = entry;
+    });
+
+    // Every edge of the subject is tested against the edges of the clip in the same cell
+    for (std::size_t cell = 0; cell < grid.cellCount(); cell++)
+    {
+        const std::size_t begin = cellStarts[cell];
+        const std::size_t end = cellStarts[cell + 1];
+        std::size_t middle = begin;
+        while (middle < end && cellEdges[middle] < subjectCount)
+        {
+            middle++;
+        }
+
+        for (std::size_t i = begin; i < middle; i++)
+        {
+            for (std::size_t j = middle; j < end; j++)
+            {
+                intersect(cellEdges[i], cellEdges[j] - subjectCount, cell);
+            }
+        }
+    }
+}
+
+void Clipper::intersect(std::uint32_t first, std::uint32_t second, std::size_t cell)
+{
+    const std::vector<Vector2>& subject = sides[0].vertices;
+    const std::vector<Vector2>& clip = sides[1].vertices;
+    const std::uint32_t firstNext = static_cast<std::uint32_t>((first + 1) % subject.size());
+    const std::uint32_t secondNext = static_cast<std::uint32_t>((second + 1) % clip.size());
+    const Vector2& a = subject[first];
+    const Vector2& b = subject[firstNext];
+    const Vector2& c = clip[second];
+    const Vector2& d = clip[secondNext];
+
+    if (std::max(a.x, b.x) < std::min(c.x, d.x) || std::max(c.x, d.x) < std::min(a.x, b.x)
+        || std::max(a.y, b.y) < std::min(c.y, d.y) || std::max(c.y, d.y) < std::min(a.y, b.y))
+    {
+        return;
+    }
+
+    auto cellOf = [this](const Vector2& point) {
+        return grid.rowIndex(point.y) * grid.columns + grid.columnIndex(point.x);
+    };
+
+    const double rx = static_cast<double>(b.x) - a.x;
+    const double ry = static_cast<double>(b.y) - a.y;
+    const double sx = static_cast<double>(d.x) - c.x;
+    const double sy = static_cast<double>(d.y) - c.y;
+    const double qx = static_cast<double>(c.x) - a.x;
+    const double qy = static_cast<double>(c.y) - a.y;
+    const double denominator = rx * sy - ry * sx;
+
+    if (denominator != 0.0)
+    {
+        const double t = (qx * sy - qy * sx) / denominator;
+        const double u = (qx * ry - qy * rx) / denominator;
+        if (t < 0.0 || t > 1.0 || u < 0.0 || u > 1.0)
+        {
+            return;
+        }
+
+        // Both edges are cut at the very same point, so the pieces meet exactly. A point a few roundings
+        // away from an end of either edge is moved onto it, so that no edge is cut right next to its end.
+        Vector2 point(static_cast<float>(a.x + t * rx), static_cast<float>(a.y + t * ry));
+        const float tolerance = SNAP_ROUNDINGS * std::numeric_limits<float>::epsilon() * std::max(std::fabs(point.x), std::fabs(point.y));
+        float nearest = tolerance;
+        Vector2 snapped = point;
+        for (const Vector2* end : { &a, &b, &c, &d })
+        {
+            const float distance = std::max(std::fabs(end->x - point.x), std::fabs(end->y - point.y));
+            if (distance <= nearest)
+            {
+                nearest = distance;
+                snapped = *end;
+            }
+        }
+        point = snapped;
+
+        if (cellOf(point) != cell)
+        {
+            return;
+        }
+
+        const Contact onClip = samePoint(point, c) ? Contact{ second, ON_VERTEX }
+            : samePoint(point, d) ? Contact{ secondNext, ON_VERTEX } : Contact{ second, ON_EDGE };
+        const Contact onSubject = samePoint(point, a) ? Contact{ first, ON_VERTEX }
+            : samePoint(point, b) ? Contact{ firstNext, ON_VERTEX } : Contact{ first, ON_EDGE };
+        addSplit(0, first, t, point, onClip);
+        addSplit(1, second, u, point, onSubject);
+        return;
+    }
+
+    if (qx * ry - qy * rx != 0.0)
+    {
+        return;
+    }
+
+    // Collinear edges, each one is cut where the other one starts and ends. The pair is handled in the
+    // cell of the first point the edges share.
+    const Vector2& firstLow = lessPoint(b, a) ? b : a;
+    const Vector2& secondLow = lessPoint(d, c) ? d : c;
+    if (cellOf(lessPoint(firstLow, secondLow) ? secondLow : firstLow) != cell)
+    {
+        return;
+    }
+
+    sides[0].collinear[first] = 1;
+    sides[1].collinear[second] = 1;
+
+    const double rr = rx * rx + ry * ry;
+    const double ss = sx * sx + sy * sy;
+    addSplit(0, first, (qx * rx + qy * ry) / rr, c, { second, ON_VERTEX });
+    addSplit(0, first, ((static_cast<double>(d.x) - a.x) * rx + (static_cast<double>(d.y) - a.y) * ry) / rr, d, { secondNext, ON_VERTEX });
+    addSplit(1, second, (-qx * sx - qy * sy) / ss, a, { first, ON_VERTEX });
+    addSplit(1, second, ((static_cast<double>(b.x) - c.x) * sx + (static_cast<double>(b.y) - c.y) * sy) / ss, b, { firstNext, ON_VERTEX });
+}
+
+void Clipper::addSplit(std::size_t side, std::uint32_t edge, double t, const Vector2& point, Contact contact)
+{
+    Side& current = sides[side];
+    if (t < 0.0 || t > 1.0)
+    {
+        return;
+    }
+
+    // A vertex of the other polygon says more about the directions around the point than an edge through it
+    auto touch = [contact](Contact& known) {
+        if (known.kind == NO_CONTACT || contact.kind == ON_VERTEX)
+        {
+            known = contact;
+        }
+    };
+
+    const std::size_t next = (edge + 1) % current.vertices.size();
+    if (samePoint(point, current.vertices[edge]))
+    {
+        touch(current.contacts[edge]);
+    }
+    else if (samePoint(point, current.vertices[next]))
+    {
+        touch(current.contacts[next]);
+    }
+    else
+    {
+        current.splits.push_back({edge, t, point, contact});
+    }
+}
+
+void Clipper::splitEdges(std::size_t side)
+{
+    Side& current = sides[side];
+    const std::vector<Vector2>& vertices = current.vertices;
+    std::sort(current.splits.begin(), current.splits.end(), [](const Split& first, const Split& second) {
+        return first.edge < second.edge || (first.edge == second.edge && first.t < second.t);
+    });
+
+    std::size_t split = 0;
+    for (std::uint32_t edge = 0; edge < vertices.size(); edge++)
+    {
+        Vector2 start = vertices[edge];
+        Contact contact = current.contacts[edge];
+        for (; split < current.splits.size() && current.splits[split].edge == edge; split++)
+        {
+            // Cuts rounded to the same point leave nothing between them, the next piece starts at the last one
+            const Split& cut = current.splits[split];
+            if (!samePoint(cut.point, start))
+            {
+                current.fragments.push_back({start, cut.point, edge, contact, OUTSIDE});
+                start = cut.point;
+            }
+            contact = cut.contact;
+        }
+
+        const Vector2& end = vertices[(edge + 1) % vertices.size()];
+        if (!samePoint(start, end))
+        {
+            current.fragments.push_back({start, end, edge, contact, OUTSIDE});
+        }
+    }
+}
+
+std::uint8_t Clipper::locate(std::size_t side, const Fragment& fragment) const
+{
+    const std::vector<Vector2>& vertices = sides[side].vertices;
+    const std::vector<Vector2>& others = sides[1 - side].vertices;
+    const Vector2& from = vertices[fragment.edge];
+    const Vector2& to = vertices[(fragment.edge + 1) % vertices.size()];
+    const std::uint32_t index = fragment.contact.index;
+
+    // The other polygon is counter-clockwise, its inside is on the left of its edges
+    if (fragment.contact.kind == ON_EDGE)
+    {
+        const double leftOfEdge = turn(others[index], others[(index + 1) % others.size()], from, to);
+        return (leftOfEdge > 0.0) ? INSIDE : (leftOfEdge < 0.0) ? OUTSIDE : UNKNOWN;
+    }
+
+    // At a vertex, the inside is the angle swept counter-clockwise from the next edge to the previous one
+    const Vector2& vertex = others[index];
+    const Vector2& next = others[(index + 1) % others.size()];
+    const Vector2& previous = others[(index + others.size() - 1) % others.size()];
+    const double leftOfNext = turn(vertex, next, from, to);
+    const double rightOfPrevious = turn(from, to, vertex, previous);
+    if ((leftOfNext == 0.0 && dot(vertex, next, from, to) > 0.0) || (rightOfPrevious == 0.0 && dot(vertex, previous, from, to) > 0.0))
+    {
+        return UNKNOWN;
+    }
+
+    const bool convex = cross(vertex, next, previous) > 0.0;
+    const bool inside = convex ? (leftOfNext > 0.0 && rightOfPrevious > 0.0) : (leftOfNext > 0.0 || rightOfPrevious > 0.0);
+    return inside ? INSIDE : OUTSIDE;
+}
+
+void Clipper::classify(std::size_t side)
+{
+    std::vector<Fragment>& fragments = sides[side].fragments;
+    const std::vector<std::uint8_t>& collinear = sides[side].collinear;
+    const std::vector<Fragment>& others = sides[1 - side].fragments;
+    const std::vector<std::uint8_t>& otherCollinear = sides[1 - side].collinear;
+    const std::vector<Vector2>& otherVertices = sides[1 - side].vertices;
+    if (otherVertices.empty())
+    {
+        return;
+    }
+
+    // The fragments of the other polygon that may be shared, sorted by their smallest then largest endpoint
+    auto low = [](const Fragment& fragment) {
+        return lessPoint(fragment.end, fragment.start) ? fragment.end : fragment.start;
+    };
+    auto high = [](const Fragment& fragment) {
+        return lessPoint(fragment.end, fragment.start) ? fragment.start : fragment.end;
+    };
+    auto lessFragment = [&](const Fragment& first, const Fragment& second) {
+        const Vector2 firstLow = low(first);
+        const Vector2 secondLow = low(second);
+        if (!samePoint(firstLow, secondLow))
+        {
+            return lessPoint(firstLow, secondLow);
+        }
+        return lessPoint(high(first), high(second));
+    };
+    sharedOrder.clear();
+    for (std::uint32_t i = 0; i < others.size(); i++)
+    {
+        if (otherCollinear[others[i].edge])
+        {
+            sharedOrder.push_back(i);
+        }
+    }
+    std::sort(sharedOrder.begin(), sharedOrder.end(), [&](std::uint32_t first, std::uint32_t second) {
+        return lessFragment(others[first], others[second]);
+    });
+
+    for (Fragment& fragment : fragments)
+    {
+        if (!collinear[fragment.edge])
+        {
+            fragment.location = UNKNOWN;
+            continue;
+        }
+
+        auto match = std::lower_bound(sharedOrder.begin(), sharedOrder.end(), fragment, [&](std::uint32_t other, const Fragment& value) {
+            return lessFragment(others[other], value);
+        });
+        const bool shared = match != sharedOrder.end() && !lessFragment(fragment, others[*match]);
+        fragment.location = !shared ? UNKNOWN : samePoint(others[*match].start, fragment.start) ? SHARED_SAME : SHARED_OPPOSITE;
+    }
+
+    // A fragment starting on the boundary of the other polygon is located there, the ones after it
+    // keep its location up to the next such fragment. The walk starts at one of them, if any.
+    std::size_t first = 0;
+    while (first < fragments.size() && (fragments[first].location != UNKNOWN || fragments[first].contact.kind == NO_CONTACT))
+    {
+        first++;
+    }
+    if (first == fragments.size())
+    {
+        first = 0;
+    }
+
+    std::uint8_t location = UNKNOWN;
+    for (std::size_t step = 0; step < fragments.size(); step++)
+    {
+        Fragment& fragment = fragments[(first + step) % fragments.size()];
+        if (fragment.location != UNKNOWN)
+        {
+            location = UNKNOWN;
+            continue;
+        }
+
+        if (fragment.contact.kind != NO_CONTACT)
+        {
+            location = locate(side, fragment);
+        }
+        // Only polygons whose boundaries never meet, or fragments running along the other polygon
+        // without sharing an edge of it, need the full test
+        if (location == UNKNOWN)
+        {
+            location = contains(otherVertices, (fragment.start + fragment.end) / 2.0f) ? INSIDE : OUTSIDE;
+        }
+        fragment.location = location;
+    }
+}
+
+void Clipper::chain(Contours& output)
+{
+    chainOrder.resize(selected.size());
+    for (std::uint32_t i = 0; i < selected.size(); i++)
+    {
+        chainOrder[i] = i;
+    }
+    std::sort(chainOrder.begin(), chainOrder.end(), [this](std::uint32_t first, std::uint32_t second) {
+        return lessPoint(selected[first].start, selected[second].start);
+    });
+    used.assign(selected.size(), 0);
+
+    for (std::uint32_t first = 0; first < selected.size(); first++)
+    {
+        if (used[first])
+        {
+            continue;
+        }
+
+        const std::size_t begin = output.vertices.size();
+        std::uint32_t current = first;
+        while (true)
+        {
+            used[current] = 1;
+
+            // Vertices in the middle of a straight run are where an edge was cut, they are dropped
+            const Vector2& point = selected[current].start;
+            while (output.vertices.size() >= begin + 2
+                && cross(output.vertices[output.vertices.size() - 2], output.vertices.back(), point) == 0.0)
+            {
+                output.vertices.pop_back();
+            }
+            output.vertices.push_back(point);
+
+            const Vector2& end = selected[current].end;
+            if (samePoint(end, selected[first].start))
+            {
+                break;
+            }
+
+            auto candidate = std::lower_bound(chainOrder.begin(), chainOrder.end(), end, [this](std::uint32_t fragment, const Vector2& value) {
+                return lessPoint(selected[fragment].start, value);
+            });
+            while (candidate != chainOrder.end() && samePoint(selected[*candidate].start, end) && used[*candidate])
+            {
+                candidate++;
+            }
+            if (candidate == chainOrder.end() || !samePoint(selected[*candidate].start, end))
+            {
+                break;
+            }
+            current = *candidate;
+        }
+
+        // The same cleanup across the point where the contour closes
+        std::size_t size = output.vertices.size() - begin;
+        Vector2* contour = output.vertices.data() + begin;
+        std::size_t skipped = 0;
+        while (size - skipped >= 3)
+        {
+            if (cross(contour[size - 2], contour[size - 1], contour[skipped]) == 0.0)
+            {
+                size--;
+            }
+            else if (cross(contour[size - 1], contour[skipped], contour[skipped + 1]) == 0.0)
+            {
+                skipped++;
+            }
+            else
+            {
+                break;
+            }
+        }
+        std::copy(contour + skipped, contour + size, contour);
+        output.vertices.resize(begin + size - skipped);
+
+        if (output.vertices.size() - begin < 3)
+        {
+            output.vertices.resize(begin);
+            continue;
+        }
+        if (output.offsets.empty())
+        {
+            output.offsets.push_back(0);
+        }
+        output.offsets.push_back(output.vertices.size());
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file CollisionChecker.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::CollisionChecker class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/CollisionChecker.hpp"
+
+#include "geometry/Gjk.hpp"
+#include "geometry/internal/simd.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    /**
+     * Tests the box [minX, maxX] x [minY, maxY] against the rects in [begin, size) of @p rects and calls
+     * @p onHit with the index of every overlapping one, in increasing order.
+     */
+    template <typename HitCallback>
+    void forEachOverlap(float minX, float minY, float maxX, float maxY, const RectArray& rects, std::size_t begin, HitCallback&& onHit)
+    {
+        const float* minXs = rects.minXData();
+        const float* minYs = rects.minYData();
+        const float* maxXs = rects.maxXData();
+        const float* maxYs = rects.maxYData();
+        const std::size_t count = rects.size();
+
+        const simd::Pack queryMinX = simd::broadcast(minX), queryMinY = simd::broadcast(minY);
+        const simd::Pack queryMaxX = simd::broadcast(maxX), queryMaxY = simd::broadcast(maxY);
+
+        std::size_t i = begin;
+        if (count > begin)
+        {
+            const std::size_t packed = begin + simd::packedEnd(count - begin);
+            for (; i < packed; i += simd::WIDTH)
+            {
+                simd::Pack overlapX = simd::lessEqual(simd::loadu(minXs + i), queryMaxX) & simd::greaterEqual(simd::loadu(maxXs + i), queryMinX);
+                simd::Pack overlapY = simd::lessEqual(simd::loadu(minYs + i), queryMaxY) & simd::greaterEqual(simd::loadu(maxYs + i), queryMinY);
+
+                unsigned mask = static_cast<unsigned>(simd::moveMask(overlapX & overlapY));
+                while (mask != 0)
+                {
+                    unsigned lane = simd::lowestSetLane(mask);
+                    onHit(static_cast<std::uint32_t>(i + lane));
+                    mask &= mask - 1;
+                }
+            }
+        }
+        for (; i < count; i++)
+        {
+            if (minXs[i] <= maxX && maxXs[i] >= minX && minYs[i] <= maxY && maxYs[i] >= minY)
+            {
+                onHit(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+}
+
+std::size_t CollisionChecker::queryOverlaps(const Rect& query, const RectArray& rects, std::vector<std::uint32_t>& hits)
+{
+    hits.clear();
+
+    const Vector2 position = query.getPosition();
+    forEachOverlap(position.x, position.y, position.x + query.getWidth(), position.y + query.getHeight(), rects, 0,
+        [&hits](std::uint32_t index) { hits.push_back(index); });
+
+    return hits.size();
+}
+
+std::size_t CollisionChecker::findOverlappingPairs(const RectArray& rects, std::vector<IndexPair>& pairs)
+{
+    pairs.clear();
+
+    const float* minXs = rects.minXData();
+    const float* minYs = rects.minYData();
+    const float* maxXs = rects.maxXData();
+    const float* maxYs = rects.maxYData();
+
+    for (std::size_t i = 0; i < rects.size(); i++)
+    {
+        const std::uint32_t first = static_cast<std::uint32_t>(i);
+        forEachOverlap(minXs[i], minYs[i], maxXs[i], maxYs[i], rects, i + 1,
+            [&pairs, first](std::uint32_t second) { pairs.push_back({first, second}); });
+    }
+
+    return pairs.size();
+}
+
+std::size_t CollisionChecker::findOverlappingPairs(const RectArray& first, const RectArray& second, std::vector<IndexPair>& pairs)
+{
+    pairs.clear();
+
+    const float* minXs = first.minXData();
+    const float* minYs = first.minYData();
+    const float* maxXs = first.maxXData();
+    const float* maxYs = first.maxYData();
+
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        const std::uint32_t firstIndex = static_cast<std::uint32_t>(i);
+        forEachOverlap(minXs[i], minYs[i], maxXs[i], maxYs[i], second, 0,
+            [&pairs, firstIndex](std::uint32_t secondIndex) { pairs.push_back({firstIndex, secondIndex}); });
+    }
+
+    return pairs.size();
+}
+
+std::size_t CollisionChecker::checkAllParallel(const std::vector<const Shape*>& shapes, const std::vector<IndexPair>& candidates, std::vector<Contact>& contacts,
+    ThreadPool& pool, bool deterministic, std::size_t grainSize)
+{
+    return checkAllParallel(candidates, [&shapes](const IndexPair& pair, Vector2& translation) {
+        return Gjk::penetration(*shapes[pair.first], *shapes[pair.second], translation);
+    }, contacts, pool, deterministic, grainSize);
+}
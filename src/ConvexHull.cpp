@@ -0,0 +1,225 @@
+/**
+ * @file ConvexHull.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::ConvexHull class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ConvexHull.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "geometry/internal/Orientation.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    /**
+     * The points with the smallest y, largest x - y, largest x, largest x + y, largest y, smallest x - y,
+     * smallest x and smallest x + y, which is counter-clockwise order around the set.
+     */
+    struct Extremes {
+        std::array<Vector2, 8> points;
+        std::array<float, 8> keys;
+
+        explicit Extremes(const Vector2& first)
+        {
+            points.fill(first);
+            keys = keysOf(first);
+        }
+
+        /**
+         * The values maximized by each of the eight points.
+         */
+        static std::array<float, 8> keysOf(const Vector2& point)
+        {
+            return {-point.y, point.x - point.y, point.x, point.x + point.y, point.y, point.y - point.x, -point.x, -point.x - point.y};
+        }
+
+        void add(const Vector2& point)
+        {
+            const std::array<float, 8> pointKeys = keysOf(point);
+            for (std::size_t i = 0; i < pointKeys.size(); i++)
+            {
+                if (pointKeys[i] > keys[i])
+                {
+                    keys[i] = pointKeys[i];
+                    points[i] = point;
+                }
+            }
+        }
+
+        void combine(const Extremes& other)
+        {
+            for (const auto& point : other.points)
+            {
+                add(point);
+            }
+        }
+    };
+
+    /**
+     * The Akl-Toussaint octagon, with repeated corners removed.
+     */
+    struct Octagon {
+        std::array<Vector2, 8> corners;
+        std::size_t count = 0;
+
+        explicit Octagon(const Extremes& extremes)
+        {
+            for (const auto& point : extremes.points)
+            {
+                if (count == 0 || !(point == corners[count - 1]))
+                {
+                    corners[count++] = point;
+                }
+            }
+            while (count > 1 && corners[count - 1] == corners[0])
+            {
+                count--;
+            }
+        }
+
+        bool strictlyContains(const Vector2& point) const
+        {
+            if (count < 3)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (cross(corners[i], corners[(i + 1) % count], point) <= 0.0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    Extremes findExtremes(const Vector2* points, std::size_t begin, std::size_t end)
+    {
+        Extremes extremes(points[begin]);
+        for (std::size_t i = begin + 1; i < end; i++)
+        {
+            extremes.add(points[i]);
+        }
+        return extremes;
+    }
+
+    void keepOutside(const Octagon& octagon, const Vector2* points, std::size_t begin, std::size_t end, std::vector<Vector2>& candidates)
+    {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (!octagon.strictlyContains(points[i]))
+            {
+                candidates.push_back(points[i]);
+            }
+        }
+    }
+
+    /**
+     * Andrew's monotone chain, sorts @p candidates in place.
+     */
+    void monotoneChain(std::vector<Vector2>& candidates, std::vector<Vector2>& hull)
+    {
+        std::sort(candidates.begin(), candidates.end(), [](const Vector2& first, const Vector2& second) {
+            return first.x < second.x || (first.x == second.x && first.y < second.y);
+        });
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        hull.clear();
+        if (candidates.size() < 3)
+        {
+            hull = candidates;
+            return;
+        }
+
+        hull.resize(2 * candidates.size());
+        std::size_t size = 0;
+
+        // The lower chain, from left to right.
+        for (const auto& point : candidates)
+        {
+            while (size >= 2 && cross(hull[size - 2], hull[size - 1], point) <= 0.0)
+            {
+                size--;
+            }
+            hull[size++] = point;
+        }
+
+        // The upper chain, from right to left.
+        const std::size_t lowerSize = size + 1;
+        for (std::size_t i = candidates.size() - 1; i-- > 0;)
+        {
+            while (size >= lowerSize && cross(hull[size - 2], hull[size - 1], candidates[i]) <= 0.0)
+            {
+                size--;
+            }
+            hull[size++] = candidates[i];
+        }
+
+        // The last point is the first one again.
+        hull.resize(size - 1);
+    }
+}
+
+std::size_t ConvexHull::compute(const Vector2* points, std::size_t count, std::vector<Vector2>& hull, ThreadPool* pool)
+{
+    hull.clear();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    if (pool == nullptr || pool->getThreadCount() == 1 || count < PARALLEL_THRESHOLD)
+    {
+        std::vector<Vector2> candidates;
+        keepOutside(Octagon(findExtremes(points, 0, count)), points, 0, count, candidates);
+        monotoneChain(candidates, hull);
+        return hull.size();
+    }
+
+    // A few chunks per thread, so the work stealing can even out the chunks that keep more points.
+    const std::size_t chunkCount = 4 * pool->getThreadCount();
+    const std::size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+    std::vector<Extremes> chunkExtremes(chunkCount, Extremes(points[0]));
+    pool->parallelFor(count, chunkSize, [&](std::size_t begin, std::size_t end, std::size_t) {
+        chunkExtremes[begin / chunkSize] = findExtremes(points, begin, end);
+    });
+
+    Extremes extremes = chunkExtremes.front();
+    for (const auto& chunk : chunkExtremes)
+    {
+        extremes.combine(chunk);
+    }
+    const Octagon octagon(extremes);
+
+    // Divide: the hull of every chunk. Conquer: the hull of the partial hulls.
+    std::vector<std::vector<Vector2>> partialHulls(chunkCount);
+    pool->parallelFor(count, chunkSize, [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<Vector2> candidates;
+        keepOutside(octagon, points, begin, end, candidates);
+        monotoneChain(candidates, partialHulls[begin / chunkSize]);
+    });
+
+    std::vector<Vector2> merged;
+    for (const auto& partialHull : partialHulls)
+    {
+        merged.insert(merged.end(), partialHull.begin(), partialHull.end());
+    }
+    monotoneChain(merged, hull);
+
+    return hull.size();
+}
+
+std::size_t ConvexHull::compute(const std::vector<Vector2>& points, std::vector<Vector2>& hull, ThreadPool* pool)
+{
+    return compute(points.data(), points.size(), hull, pool);
+}
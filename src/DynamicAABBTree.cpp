@@ -0,0 +1,628 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::DynamicAABBTree class
+ * 
+ * The nodes live in one contiguous vector and refer to each other by index, freed nodes are chained
+ * in a free list and reused. Insertion picks the sibling with the surface area heuristic and the
+ * tree is kept balanced with AVL-style rotations on the way back to the root.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/DynamicAABBTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/internal/GrowableStack.hpp"
+#include "geometry/internal/common.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    constexpr std::size_t TRAVERSAL_STACK_SIZE = 256;
+
+    /**
+     * Clips the segment p + t * d, t in [0, 1], against @p box. On a hit, @p enter is the first t inside the box.
+     */
+    bool segmentHitsBox(const Vector2& p, const Vector2& d, const Box& box, float& enter)
+    {
+        float tMin = 0.0f, tMax = 1.0f;
+
+        const float origin[2] = { p.x, p.y };
+        const float direction[2] = { d.x, d.y };
+        const float boxMin[2] = { box.minX, box.minY };
+        const float boxMax[2] = { box.maxX, box.maxY };
+
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (std::fabs(direction[axis]) < FLOAT_EPSILON)
+            {
+                if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            float inverse = 1.0f / direction[axis];
+            float t1 = (boxMin[axis] - origin[axis]) * inverse;
+            float t2 = (boxMax[axis] - origin[axis]) * inverse;
+            if (t1 > t2)
+            {
+                std::swap(t1, t2);
+            }
+
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+            {
+                return false;
+            }
+        }
+
+        enter = tMin;
+        return true;
+    }
+}
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : margin(margin)
+{
+
+}
+
+std::size_t DynamicAABBTree::findPairs(std::vector<IndexPair>& pairs) const
+{
+    pairs.clear();
+    if (root == NULL_NODE)
+    {
+        return 0;
+    }
+
+    // Descends the tree against itself. A pair (n, n) stands for the pairs inside the subtree of n, any
+    // other pair for the pairs between the two subtrees, so every pair of leaves is reached exactly once.
+    struct NodePair {
+        std::int32_t first;
+        std::int32_t second;
+    };
+    auto pruningBox = [this](const Node& node) -> const Box& {
+        return node.isLeaf() ? node.bounds : node.fatBounds;
+    };
+
+    GrowableStack<NodePair, TRAVERSAL_STACK_SIZE> stack;
+    stack.push({root, root});
+
+    while (!stack.empty())
+    {
+        const NodePair pair = stack.pop();
+        const Node& first = nodes[pair.first];
+        const Node& second = nodes[pair.second];
+
+        if (pair.first == pair.second)
+        {
+            if (!first.isLeaf())
+            {
+                stack.push({first.child1, first.child1});
+                stack.push({first.child2, first.child2});
+                stack.push({first.child1, first.child2});
+            }
+            continue;
+        }
+
+        if (!pruningBox(first).overlaps(pruningBox(second)))
+        {
+            continue;
+        }
+
+        if (first.isLeaf() && second.isLeaf())
+        {
+            pairs.push_back({std::min(first.userData, second.userData), std::max(first.userData, second.userData)});
+        }
+        else if (second.isLeaf() || (!first.isLeaf() && first.fatBounds.perimeter() >= second.fatBounds.perimeter()))
+        {
+            // The larger subtree is split, which keeps the boxes of a pair of similar sizes
+            stack.push({first.child1, pair.second});
+            stack.push({first.child2, pair.second});
+        }
+        else
+        {
+            stack.push({pair.first, second.child1});
+            stack.push({pair.first, second.child2});
+        }
+    }
+
+    return pairs.size();
+}
+
+std::size_t DynamicAABBTree::query(const Rect& region, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+    forEachOverlap(Box::fromRect(region), [&](std::int32_t leaf) { hits.push_back(nodes[leaf].userData); });
+    return hits.size();
+}
+
+std::size_t DynamicAABBTree::queryPoint(const Vector2& point, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+    forEachOverlap(Box{ point.x, point.y, point.x, point.y }, [&](std::int32_t leaf) { hits.push_back(nodes[leaf].userData); });
+    return hits.size();
+}
+
+std::size_t DynamicAABBTree::raycast(const Vector2& from, const Vector2& to, std::vector<RaycastHit>& hits) const
+{
+    hits.clear();
+    if (root == NULL_NODE)
+    {
+        return 0;
+    }
+
+    const Vector2 direction = to - from;
+    GrowableStack<std::int32_t, TRAVERSAL_STACK_SIZE> stack;
+    stack.push(root);
+
+    while (!stack.empty())
+    {
+        const Node& node = nodes[stack.pop()];
+        float enter;
+        if (!segmentHitsBox(from, direction, node.fatBounds, enter))
+        {
+            continue;
+        }
+
+        if (node.isLeaf())
+        {
+            if (segmentHitsBox(from, direction, node.bounds, enter))
+            {
+                hits.push_back({node.userData, enter});
+            }
+        }
+        else
+        {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+
+    std::sort(hits.begin(), hits.end(), [](const RaycastHit& a, const RaycastHit& b) { return a.fraction < b.fraction; });
+    return hits.size();
+}
+
+std::size_t DynamicAABBTree::size() const
+{
+    return leafCount;
+}
+
+int DynamicAABBTree::getHeight() const
+{
+    return (root == NULL_NODE) ? 0 : nodes[root].height;
+}
+
+std::uint32_t DynamicAABBTree::getUserData(ProxyId proxy) const
+{
+    return nodes[proxy].userData;
+}
+
+Rect DynamicAABBTree::getBounds(ProxyId proxy) const
+{
+    return nodes[proxy].bounds.toRect();
+}
+
+Rect DynamicAABBTree::getFatBounds(ProxyId proxy) const
+{
+    return nodes[proxy].fatBounds.toRect();
+}
+
+bool DynamicAABBTree::isValid() const
+{
+    bool valid = true;
+    if (root != NULL_NODE)
+    {
+        validateSubtree(root, NULL_NODE, valid);
+    }
+
+    std::size_t freeCount = 0;
+    for (std::int32_t node = freeList; node != NULL_NODE; node = nodes[node].parent)
+    {
+        freeCount++;
+    }
+
+    // Every leaf except the first one comes with one internal node.
+    std::size_t usedCount = (leafCount == 0) ? 0 : 2 * leafCount - 1;
+    return valid && (usedCount + freeCount == nodes.size());
+}
+
+DynamicAABBTree::ProxyId DynamicAABBTree::insert(const Rect& bounds, std::uint32_t userData)
+{
+    std::int32_t leaf = allocateNode();
+    Node& node = nodes[leaf];
+
+    node.bounds = Box::fromRect(bounds);
+    node.fatBounds = { node.bounds.minX - margin, node.bounds.minY - margin, node.bounds.maxX + margin, node.bounds.maxY + margin };
+    node.userData = userData;
+    node.height = 0;
+
+    insertLeaf(leaf);
+    leafCount++;
+    return leaf;
+}
+
+DynamicAABBTree::ProxyId DynamicAABBTree::insert(const Shape& shape, std::uint32_t userData)
+{
+    return insert(shape.bounds(), userData);
+}
+
+void DynamicAABBTree::remove(ProxyId proxy)
+{
+    if (proxy < 0 || proxy >= static_cast<ProxyId>(nodes.size()) || nodes[proxy].height != 0)
+    {
+        throw std::invalid_argument("The proxy is not a leaf of the tree!");
+    }
+
+    removeLeaf(proxy);
+    freeNode(proxy);
+    leafCount--;
+}
+
+bool DynamicAABBTree::update(ProxyId proxy, const Rect& bounds, const Vector2& displacement)
+{
+    if (proxy < 0 || proxy >= static_cast<ProxyId>(nodes.size()) || nodes[proxy].height != 0)
+    {
+        throw std::invalid_argument("The proxy is not a leaf of the tree!");
+    }
+
+    Node& node = nodes[proxy];
+    node.bounds = Box::fromRect(bounds);
+
+    if (node.fatBounds.contains(node.bounds))
+    {
+        return false;
+    }
+
+    removeLeaf(proxy);
+
+    Box fat = { node.bounds.minX - margin, node.bounds.minY - margin, node.bounds.maxX + margin, node.bounds.maxY + margin };
+    const Vector2 predicted = displacement * DISPLACEMENT_MULTIPLIER;
+    (predicted.x < 0.0f ? fat.minX : fat.maxX) += predicted.x;
+    (predicted.y < 0.0f ? fat.minY : fat.maxY) += predicted.y;
+    nodes[proxy].fatBounds = fat;
+
+    insertLeaf(proxy);
+    return true;
+}
+
+void DynamicAABBTree::clear()
+{
+    nodes.clear();
+    root = NULL_NODE;
+    freeList = NULL_NODE;
+    leafCount = 0;
+}
+
+std::int32_t DynamicAABBTree::allocateNode()
+{
+    std::int32_t node;
+    if (freeList != NULL_NODE)
+    {
+        node = freeList;
+        freeList = nodes[node].parent;
+    }
+    else
+    {
+        node = static_cast<std::int32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    nodes[node].parent = NULL_NODE;
+    nodes[node].child1 = NULL_NODE;
+    nodes[node].child2 = NULL_NODE;
+    nodes[node].height = 0;
+    nodes[node].userData = 0;
+    return node;
+}
+
+void DynamicAABBTree::freeNode(std::int32_t node)
+{
+    nodes[node].parent = freeList;
+    nodes[node].height = -1;
+    freeList = node;
+}
+
+void DynamicAABBTree::insertLeaf(std::int32_t leaf)
+{
+    if (root == NULL_NODE)
+    {
+        root = leaf;
+        nodes[root].parent = NULL_NODE;
+        return;
+    }
+
+    // Walk down to the sibling that makes the tree grow the least (surface area heuristic).
+    const Box leafBox = nodes[leaf].fatBounds;
+    std::int32_t index = root;
+    while (!nodes[index].isLeaf())
+    {
+        const Node& node = nodes[index];
+        const float area = node.fatBounds.perimeter();
+        const float combinedArea = Box::combine(node.fatBounds, leafBox).perimeter();
+
+        // Making a new parent for this node and the leaf.
+        const float cost = 2.0f * combinedArea;
+
+        // Descending pushes the leaf bounds into every ancestor below this node.
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](std::int32_t child) {
+            const Node& childNode = nodes[child];
+            float enlarged = Box::combine(leafBox, childNode.fatBounds).perimeter();
+            return childNode.isLeaf() ? enlarged + inheritanceCost : (enlarged - childNode.fatBounds.perimeter()) + inheritanceCost;
+        };
+
+        const float cost1 = descendCost(node.child1);
+        const float cost2 = descendCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+        {
+            break;
+        }
+        index = (cost1 < cost2) ? node.child1 : node.child2;
+    }
+
+    const std::int32_t sibling = index;
+    const std::int32_t oldParent = nodes[sibling].parent;
+    const std::int32_t newParent = allocateNode();
+
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].fatBounds = Box::combine(leafBox, nodes[sibling].fatBounds);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (nodes[oldParent].child1 == sibling)
+        {
+            nodes[oldParent].child1 = newParent;
+        }
+        else
+        {
+            nodes[oldParent].child2 = newParent;
+        }
+    }
+    else
+    {
+        root = newParent;
+    }
+
+    refitUpwards(nodes[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(std::int32_t leaf)
+{
+    if (leaf == root)
+    {
+        root = NULL_NODE;
+        return;
+    }
+
+    const std::int32_t parent = nodes[leaf].parent;
+    const std::int32_t grandParent = nodes[parent].parent;
+    const std::int32_t sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent != NULL_NODE)
+    {
+        if (nodes[grandParent].child1 == parent)
+        {
+            nodes[grandParent].child1 = sibling;
+        }
+        else
+        {
+            nodes[grandParent].child2 = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitUpwards(grandParent);
+    }
+    else
+    {
+        root = sibling;
+        nodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+    }
+}
+
+void DynamicAABBTree::refitUpwards(std::int32_t index)
+{
+    while (index != NULL_NODE)
+    {
+        index = balance(index);
+
+        Node& node = nodes[index];
+        const Node& child1 = nodes[node.child1];
+        const Node& child2 = nodes[node.child2];
+
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.fatBounds = Box::combine(child1.fatBounds, child2.fatBounds);
+
+        index = node.parent;
+    }
+}
+
+std::int32_t DynamicAABBTree::balance(std::int32_t iA)
+{
+    Node& a = nodes[iA];
+    if (a.isLeaf() || a.height < 2)
+    {
+        return iA;
+    }
+
+    const std::int32_t iB = a.child1;
+    const std::int32_t iC = a.child2;
+    Node& b = nodes[iB];
+    Node& c = nodes[iC];
+
+    const int balanceFactor = c.height - b.height;
+
+    auto replaceInParent = [&](std::int32_t parent, std::int32_t newChild) {
+        if (parent == NULL_NODE)
+        {
+            root = newChild;
+        }
+        else if (nodes[parent].child1 == iA)
+        {
+            nodes[parent].child1 = newChild;
+        }
+        else
+        {
+            nodes[parent].child2 = newChild;
+        }
+    };
+
+    // Rotate C up.
+    if (balanceFactor > 1)
+    {
+        const std::int32_t iF = c.child1;
+        const std::int32_t iG = c.child2;
+        Node& f = nodes[iF];
+        Node& g = nodes[iG];
+
+        c.child1 = iA;
+        c.parent = a.parent;
+        a.parent = iC;
+        replaceInParent(c.parent, iC);
+
+        if (f.height > g.height)
+        {
+            c.child2 = iF;
+            a.child2 = iG;
+            g.parent = iA;
+            a.fatBounds = Box::combine(b.fatBounds, g.fatBounds);
+            c.fatBounds = Box::combine(a.fatBounds, f.fatBounds);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        }
+        else
+        {
+            c.child2 = iG;
+            a.child2 = iF;
+            f.parent = iA;
+            a.fatBounds = Box::combine(b.fatBounds, f.fatBounds);
+            c.fatBounds = Box::combine(a.fatBounds, g.fatBounds);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return iC;
+    }
+
+    // Rotate B up.
+    if (balanceFactor < -1)
+    {
+        const std::int32_t iD = b.child1;
+        const std::int32_t iE = b.child2;
+        Node& d = nodes[iD];
+        Node& e = nodes[iE];
+
+        b.child1 = iA;
+        b.parent = a.parent;
+        a.parent = iB;
+        replaceInParent(b.parent, iB);
+
+        if (d.height > e.height)
+        {
+            b.child2 = iD;
+            a.child1 = iE;
+            e.parent = iA;
+            a.fatBounds = Box::combine(c.fatBounds, e.fatBounds);
+            b.fatBounds = Box::combine(a.fatBounds, d.fatBounds);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        }
+        else
+        {
+            b.child2 = iE;
+            a.child1 = iD;
+            d.parent = iA;
+            a.fatBounds = Box::combine(c.fatBounds, d.fatBounds);
+            b.fatBounds = Box::combine(a.fatBounds, e.fatBounds);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+int DynamicAABBTree::validateSubtree(std::int32_t index, std::int32_t parent, bool& valid) const
+{
+    const Node& node = nodes[index];
+    if (node.parent != parent)
+    {
+        valid = false;
+    }
+
+    if (node.isLeaf())
+    {
+        if (node.height != 0 || node.child2 != NULL_NODE || !node.fatBounds.contains(node.bounds))
+        {
+            valid = false;
+        }
+        return 0;
+    }
+
+    const int height1 = validateSubtree(node.child1, index, valid);
+    const int height2 = validateSubtree(node.child2, index, valid);
+    const int height = 1 + std::max(height1, height2);
+
+    if (node.height != height)
+    {
+        valid = false;
+    }
+    if (!node.fatBounds.contains(nodes[node.child1].fatBounds) || !node.fatBounds.contains(nodes[node.child2].fatBounds))
+    {
+        valid = false;
+    }
+    return height;
+}
+
+template <typename Visitor>
+void DynamicAABBTree::forEachOverlap(const Box& box, Visitor&& visit) const
+{
+    if (root == NULL_NODE)
+    {
+        return;
+    }
+
+    GrowableStack<std::int32_t, TRAVERSAL_STACK_SIZE> stack;
+    stack.push(root);
+
+    while (!stack.empty())
+    {
+        const std::int32_t index = stack.pop();
+        const Node& node = nodes[index];
+        if (!node.fatBounds.overlaps(box))
+        {
+            continue;
+        }
+
+        if (node.isLeaf())
+        {
+            if (node.bounds.overlaps(box))
+            {
+                visit(index);
+            }
+        }
+        else
+        {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+}
@@ -0,0 +1,223 @@
+/**
+ * @file Fixed.cpp
+ * 
+ * @brief Implementation of the integer-only math functions of @c geometry::Fixed
+ * 
+ * The trigonometric functions use CORDIC iterations on 64 bit integers in Q2.30 format,
+ * which leaves enough headroom for the rounding to Q16.16 at the end.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Fixed.hpp"
+
+#include <limits>
+
+using namespace geometry;
+
+namespace {
+    constexpr int CORDIC_ITERATIONS = 30;
+    constexpr int Q30_SHIFT = 30 - Fixed::FRACTION_BITS;
+
+    /**
+     * atan(2^-i) in Q2.30, precomputed so the results don't depend on the platform libm.
+     */
+    constexpr std::int64_t ATAN_TABLE[CORDIC_ITERATIONS] = {
+        843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437,
+        4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768,
+        16384, 8192, 4096, 2048, 1024, 512, 256, 128,
+        64, 32, 16, 8, 4, 2
+    };
+
+    /**
+     * The inverse of the CORDIC gain, prod(cos(atan(2^-i))), in Q2.30.
+     */
+    constexpr std::int64_t CORDIC_GAIN = 652032874;
+
+    constexpr std::int64_t PI_Q30 = 3373259426LL;
+    constexpr std::int64_t HALF_PI_Q30 = 1686629713LL;
+    constexpr std::int64_t TWO_PI_Q30 = 2 * PI_Q30;
+
+    std::uint64_t integerSqrt(std::uint64_t value)
+    {
+        std::uint64_t result = 0;
+        std::uint64_t bit = std::uint64_t(1) << 62;
+
+        while (bit > value)
+        {
+            bit >>= 2;
+        }
+        while (bit != 0)
+        {
+            if (value >= result + bit)
+            {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else
+            {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+    Fixed fromQ30(std::int64_t value)
+    {
+        constexpr std::int64_t half = std::int64_t(1) << (Q30_SHIFT - 1);
+        return Fixed::fromRaw(static_cast<Fixed::Raw>((value + half) >> Q30_SHIFT));
+    }
+
+    /**
+     * Rotates (1, 0) by @p angle, which is reduced to [-pi, pi] first, and returns cos and sin in Q2.30.
+     */
+    void cordicRotate(Fixed angleRadians, std::int64_t& cosOut, std::int64_t& sinOut)
+    {
+        std::int64_t angle = (static_cast<std::int64_t>(angleRadians.getRaw()) * (std::int64_t(1) << Q30_SHIFT)) % TWO_PI_Q30;
+        if (angle > PI_Q30)
+        {
+            angle -= TWO_PI_Q30;
+        }
+        else if (angle < -PI_Q30)
+        {
+            angle += TWO_PI_Q30;
+        }
+
+        // CORDIC converges for |angle| <= ~1.74, so the outer quadrants are mirrored: sin stays, cos flips.
+        bool mirrored = false;
+        if (angle > HALF_PI_Q30)
+        {
+            angle = PI_Q30 - angle;
+            mirrored = true;
+        }
+        else if (angle < -HALF_PI_Q30)
+        {
+            angle = -PI_Q30 - angle;
+            mirrored = true;
+        }
+
+        std::int64_t x = CORDIC_GAIN, y = 0;
+        for (int i = 0; i < CORDIC_ITERATIONS; i++)
+        {
+            std::int64_t shiftedX = x >> i;
+            std::int64_t shiftedY = y >> i;
+            if (angle >= 0)
+            {
+                x -= shiftedY;
+                y += shiftedX;
+                angle -= ATAN_TABLE[i];
+            }
+            else
+            {
+                x += shiftedY;
+                y -= shiftedX;
+                angle += ATAN_TABLE[i];
+            }
+        }
+
+        cosOut = mirrored ? -x : x;
+        sinOut = y;
+    }
+}
+
+Fixed geometry::sqrt(Fixed value)
+{
+    if (value.getRaw() < 0)
+    {
+        throw std::domain_error("Can't compute the square root of a negative number!");
+    }
+    std::uint64_t shifted = static_cast<std::uint64_t>(value.getRaw()) << Fixed::FRACTION_BITS;
+    return Fixed::fromRaw(static_cast<Fixed::Raw>(integerSqrt(shifted)));
+}
+
+Fixed geometry::hypot(Fixed x, Fixed y)
+{
+    std::int64_t rawX = x.getRaw(), rawY = y.getRaw();
+    std::uint64_t squares = static_cast<std::uint64_t>(rawX * rawX) + static_cast<std::uint64_t>(rawY * rawY);
+    std::uint64_t result = integerSqrt(squares);
+
+    if (result > static_cast<std::uint64_t>(std::numeric_limits<Fixed::Raw>::max()))
+    {
+        return Fixed::fromRaw(std::numeric_limits<Fixed::Raw>::max());
+    }
+    return Fixed::fromRaw(static_cast<Fixed::Raw>(result));
+}
+
+Fixed geometry::sin(Fixed angleRadians)
+{
+    std::int64_t cosValue, sinValue;
+    cordicRotate(angleRadians, cosValue, sinValue);
+    return fromQ30(sinValue);
+}
+
+Fixed geometry::cos(Fixed angleRadians)
+{
+    std::int64_t cosValue, sinValue;
+    cordicRotate(angleRadians, cosValue, sinValue);
+    return fromQ30(cosValue);
+}
+
+Fixed geometry::atan2(Fixed y, Fixed x)
+{
+    std::int64_t vectorX = static_cast<std::int64_t>(x.getRaw()) * (std::int64_t(1) << Q30_SHIFT);
+    std::int64_t vectorY = static_cast<std::int64_t>(y.getRaw()) * (std::int64_t(1) << Q30_SHIFT);
+    std::int64_t angle = 0;
+
+    if (vectorX == 0 && vectorY == 0)
+    {
+        return Fixed();
+    }
+
+    // Vectoring mode needs x >= 0, the left half-plane is first rotated by -pi/2 or pi/2.
+    if (vectorX < 0)
+    {
+        std::int64_t oldX = vectorX;
+        if (vectorY >= 0)
+        {
+            vectorX = vectorY;
+            vectorY = -oldX;
+            angle = HALF_PI_Q30;
+        }
+        else
+        {
+            vectorX = -vectorY;
+            vectorY = oldX;
+            angle = -HALF_PI_Q30;
+        }
+    }
+
+    for (int i = 0; i < CORDIC_ITERATIONS; i++)
+    {
+        std::int64_t shiftedX = vectorX >> i;
+        std::int64_t shiftedY = vectorY >> i;
+        if (vectorY > 0)
+        {
+            vectorX += shiftedY;
+            vectorY -= shiftedX;
+            angle += ATAN_TABLE[i];
+        }
+        else
+        {
+            vectorX -= shiftedY;
+            vectorY += shiftedX;
+            angle -= ATAN_TABLE[i];
+        }
+    }
+
+    return fromQ30(angle);
+}
+
+Fixed geometry::acos(Fixed value)
+{
+    if (value > Fixed(1))
+    {
+        value = Fixed(1);
+    }
+    else if (value < Fixed(-1))
+    {
+        value = Fixed(-1);
+    }
+    return atan2(sqrt(Fixed(1) - value * value), value);
+}
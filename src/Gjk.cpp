@@ -0,0 +1,439 @@
+/**
+ * @file Gjk.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::Gjk class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Gjk.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+#include "geometry/internal/common.hpp"
+
+using namespace geometry;
+
+namespace {
+    constexpr int MAX_ITERATIONS = 32;
+    constexpr int MAX_POLYTOPE_VERTICES = 64;
+    constexpr float RELATIVE_TOLERANCE = 1.0e-5f;
+    constexpr float SQUARED_EPSILON = FLOAT_EPSILON * FLOAT_EPSILON;
+
+    float cross(const Vector2& first, const Vector2& second)
+    {
+        return first.x * second.y - first.y * second.x;
+    }
+
+    /**
+     * A point of the Minkowski difference, with the support points it came from and its barycentric weight.
+     */
+    struct SimplexVertex {
+        Vector2 onFirst;
+        Vector2 onSecond;
+        Vector2 point;
+        Vector2 direction;
+        float weight;
+    };
+
+    SimplexVertex makeVertex(const Shape& first, const Shape& second, const Vector2& direction)
+    {
+        SimplexVertex vertex;
+        vertex.direction = direction;
+        vertex.onFirst = first.support(direction);
+        vertex.onSecond = second.support(-direction);
+        vertex.point = vertex.onFirst - vertex.onSecond;
+        vertex.weight = 1.0f;
+        return vertex;
+    }
+
+    /**
+     * The simplex of the GJK loop, reduced after every step to the smallest feature closest to the origin.
+     * The reductions follow the barycentric regions of Box2D's b2Simplex.
+     */
+    struct Simplex {
+        std::array<SimplexVertex, 3> vertices;
+        int count = 0;
+
+        Vector2 closestPoint() const
+        {
+            Vector2 point;
+            for (int i = 0; i < count; i++)
+            {
+                point += vertices[i].point * vertices[i].weight;
+            }
+            return point;
+        }
+
+        void witnessPoints(Vector2& onFirst, Vector2& onSecond) const
+        {
+            onFirst = onSecond = Vector2();
+            for (int i = 0; i < count; i++)
+            {
+                onFirst += vertices[i].onFirst * vertices[i].weight;
+                onSecond += vertices[i].onSecond * vertices[i].weight;
+            }
+        }
+
+        void solve()
+        {
+            if (count == 1)
+            {
+                vertices[0].weight = 1.0f;
+            }
+            else if (count == 2)
+            {
+                solveSegment();
+            }
+            else if (count == 3)
+            {
+                solveTriangle();
+            }
+        }
+
+        void solveSegment()
+        {
+            const Vector2 w1 = vertices[0].point, w2 = vertices[1].point;
+            const Vector2 e12 = w2 - w1;
+
+            const float d12_2 = -w1.dot(e12);
+            if (d12_2 <= 0.0f)
+            {
+                keepVertex(0);
+                return;
+            }
+
+            const float d12_1 = w2.dot(e12);
+            if (d12_1 <= 0.0f)
+            {
+                keepVertex(1);
+                return;
+            }
+
+            const float inverse = 1.0f / (d12_1 + d12_2);
+            vertices[0].weight = d12_1 * inverse;
+            vertices[1].weight = d12_2 * inverse;
+        }
+
+        void solveTriangle()
+        {
+            const Vector2 w1 = vertices[0].point, w2 = vertices[1].point, w3 = vertices[2].point;
+
+            const Vector2 e12 = w2 - w1;
+            const float d12_1 = w2.dot(e12), d12_2 = -w1.dot(e12);
+
+            const Vector2 e13 = w3 - w1;
+            const float d13_1 = w3.dot(e13), d13_2 = -w1.dot(e13);
+
+            const Vector2 e23 = w3 - w2;
+            const float d23_1 = w3.dot(e23), d23_2 = -w2.dot(e23);
+
+            const float n123 = cross(e12, e13);
+            const float d123_1 = n123 * cross(w2, w3);
+            const float d123_2 = n123 * cross(w3, w1);
+            const float d123_3 = n123 * cross(w1, w2);
+
+            if (d12_2 <= 0.0f && d13_2 <= 0.0f)
+            {
+                keepVertex(0);
+            }
+            else if (d12_1 > 0.0f && d12_2 > 0.0f && d123_3 <= 0.0f)
+            {
+                keepEdge(0, 1, d12_1, d12_2);
+            }
+            else if (d13_1 > 0.0f && d13_2 > 0.0f && d123_2 <= 0.0f)
+            {
+                keepEdge(0, 2, d13_1, d13_2);
+            }
+            else if (d12_1 <= 0.0f && d23_2 <= 0.0f)
+            {
+                keepVertex(1);
+            }
+            else if (d13_1 <= 0.0f && d23_1 <= 0.0f)
+            {
+                keepVertex(2);
+            }
+            else if (d23_1 > 0.0f && d23_2 > 0.0f && d123_1 <= 0.0f)
+            {
+                keepEdge(1, 2, d23_1, d23_2);
+            }
+            else if (d123_1 + d123_2 + d123_3 > 0.0f)
+            {
+                const float inverse = 1.0f / (d123_1 + d123_2 + d123_3);
+                vertices[0].weight = d123_1 * inverse;
+                vertices[1].weight = d123_2 * inverse;
+                vertices[2].weight = d123_3 * inverse;
+            }
+            else
+            {
+                // A flat triangle, the origin lies on the line through it.
+                count = 2;
+                solveSegment();
+            }
+        }
+
+        void keepVertex(int index)
+        {
+            vertices[0] = vertices[index];
+            vertices[0].weight = 1.0f;
+            count = 1;
+        }
+
+        void keepEdge(int firstIndex, int secondIndex, float firstWeight, float secondWeight)
+        {
+            const float inverse = 1.0f / (firstWeight + secondWeight);
+            const SimplexVertex second = vertices[secondIndex];
+
+            vertices[0] = vertices[firstIndex];
+            vertices[0].weight = firstWeight * inverse;
+            vertices[1] = second;
+            vertices[1].weight = secondWeight * inverse;
+            count = 2;
+        }
+    };
+
+    /**
+     * Rebuilds the simplex of the previous query from its search directions, dropping the vertices
+     * that became degenerate since then.
+     */
+    void warmStart(const Shape& first, const Shape& second, const GjkSimplex& cached, Simplex& simplex)
+    {
+        simplex.count = std::clamp(cached.count, 1, 3);
+        for (int i = 0; i < simplex.count; i++)
+        {
+            simplex.vertices[i] = makeVertex(first, second, cached.directions[i]);
+        }
+
+        if (simplex.count == 3)
+        {
+            const Vector2 e12 = simplex.vertices[1].point - simplex.vertices[0].point;
+            const Vector2 e13 = simplex.vertices[2].point - simplex.vertices[0].point;
+            if (std::fabs(cross(e12, e13)) <= SQUARED_EPSILON)
+            {
+                simplex.count = 2;
+            }
+        }
+        if (simplex.count == 2)
+        {
+            const Vector2 e12 = simplex.vertices[1].point - simplex.vertices[0].point;
+            if (e12.dot(e12) <= SQUARED_EPSILON)
+            {
+                simplex.count = 1;
+            }
+        }
+    }
+
+    /**
+     * The GJK loop. When @p stopWhenSeparated is set it returns as soon as a support point proves the
+     * shapes apart, without refining the distance.
+     */
+    bool runGjk(const Shape& first, const Shape& second, Simplex& simplex, GjkDistance& result, GjkSimplex* cached, bool stopWhenSeparated)
+    {
+        if (cached != nullptr && cached->count > 0)
+        {
+            warmStart(first, second, *cached, simplex);
+        }
+        else
+        {
+            simplex.vertices[0] = makeVertex(first, second, Vector2(1.0f, 0.0f));
+            simplex.count = 1;
+        }
+
+        int iterations = simplex.count;
+        bool intersecting = false;
+        while (true)
+        {
+            simplex.solve();
+            if (simplex.count == 3)
+            {
+                intersecting = true;
+                break;
+            }
+
+            const Vector2 closest = simplex.closestPoint();
+            const float squaredDistance = closest.dot(closest);
+            if (squaredDistance <= SQUARED_EPSILON)
+            {
+                intersecting = true;
+                break;
+            }
+            if (iterations >= MAX_ITERATIONS)
+            {
+                break;
+            }
+
+            const SimplexVertex vertex = makeVertex(first, second, -closest);
+            iterations++;
+
+            const float projection = closest.dot(vertex.point);
+            if (stopWhenSeparated && projection > 0.0f)
+            {
+                break;
+            }
+            if (squaredDistance - projection <= RELATIVE_TOLERANCE * squaredDistance)
+            {
+                break;
+            }
+
+            bool duplicate = false;
+            for (int i = 0; i < simplex.count; i++)
+            {
+                duplicate = duplicate || (vertex.point == simplex.vertices[i].point);
+            }
+            if (duplicate)
+            {
+                break;
+            }
+
+            simplex.vertices[simplex.count++] = vertex;
+        }
+
+        simplex.witnessPoints(result.pointOnFirst, result.pointOnSecond);
+        result.distance = intersecting ? 0.0f : (result.pointOnSecond - result.pointOnFirst).lenght();
+        result.iterations = iterations;
+
+        if (cached != nullptr)
+        {
+            cached->count = simplex.count;
+            for (int i = 0; i < simplex.count; i++)
+            {
+                cached->directions[i] = simplex.vertices[i].direction;
+            }
+        }
+
+        return intersecting;
+    }
+
+    /**
+     * Grows the final GJK simplex into a triangle, which EPA needs to start from.
+     * 
+     * @returns false if the Minkowski difference is flat, so there is no triangle to build.
+     */
+    bool expandToTriangle(const Shape& first, const Shape& second, Simplex& simplex)
+    {
+        if (simplex.count == 1)
+        {
+            const std::array<Vector2, 4> directions = {Vector2(1.0f, 0.0f), Vector2(-1.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(0.0f, -1.0f)};
+            for (const auto& direction : directions)
+            {
+                const SimplexVertex vertex = makeVertex(first, second, direction);
+                const Vector2 offset = vertex.point - simplex.vertices[0].point;
+                if (offset.dot(offset) > SQUARED_EPSILON)
+                {
+                    simplex.vertices[simplex.count++] = vertex;
+                    break;
+                }
+            }
+        }
+
+        if (simplex.count == 2)
+        {
+            const Vector2 edge = simplex.vertices[1].point - simplex.vertices[0].point;
+            const Vector2 normal(-edge.y, edge.x);
+
+            for (const auto& direction : {normal, -normal})
+            {
+                const SimplexVertex vertex = makeVertex(first, second, direction);
+                if (std::fabs(cross(edge, vertex.point - simplex.vertices[0].point)) > SQUARED_EPSILON)
+                {
+                    simplex.vertices[simplex.count++] = vertex;
+                    break;
+                }
+            }
+        }
+
+        return simplex.count == 3;
+    }
+}
+
+bool Gjk::distance(const Shape& first, const Shape& second, GjkDistance& result, GjkSimplex* simplex)
+{
+    Simplex solver;
+    return runGjk(first, second, solver, result, simplex, false);
+}
+
+bool Gjk::intersects(const Shape& first, const Shape& second, GjkSimplex* simplex)
+{
+    Simplex solver;
+    GjkDistance result;
+    return runGjk(first, second, solver, result, simplex, true);
+}
+
+bool Gjk::penetration(const Shape& first, const Shape& second, Vector2& translation, GjkSimplex* simplex)
+{
+    Simplex solver;
+    GjkDistance result;
+    if (!runGjk(first, second, solver, result, simplex, true))
+    {
+        return false;
+    }
+
+    if (!expandToTriangle(first, second, solver))
+    {
+        translation = Vector2();
+        return true;
+    }
+
+    std::array<Vector2, MAX_POLYTOPE_VERTICES> polytope;
+    int count = 3;
+    for (int i = 0; i < 3; i++)
+    {
+        polytope[i] = solver.vertices[i].point;
+    }
+    if (cross(polytope[1] - polytope[0], polytope[2] - polytope[0]) < 0.0f)
+    {
+        std::swap(polytope[1], polytope[2]);
+    }
+
+    Vector2 normal;
+    float depth = 0.0f;
+    while (true)
+    {
+        // The edge closest to the origin, with its outward normal.
+        int closestEdge = -1;
+        float closestDistance = std::numeric_limits<float>::max();
+        for (int i = 0; i < count; i++)
+        {
+            const Vector2 edge = polytope[(i + 1) % count] - polytope[i];
+            const float lenght = edge.lenght();
+            if (lenght <= FLOAT_EPSILON)
+            {
+                continue;
+            }
+
+            const Vector2 edgeNormal(edge.y / lenght, -edge.x / lenght);
+            const float edgeDistance = edgeNormal.dot(polytope[i]);
+            if (edgeDistance < closestDistance)
+            {
+                closestEdge = i;
+                closestDistance = edgeDistance;
+                normal = edgeNormal;
+            }
+        }
+
+        if (closestEdge < 0)
+        {
+            normal = Vector2();
+            break;
+        }
+        depth = closestDistance;
+
+        const Vector2 point = first.support(normal) - second.support(-normal);
+        const float reach = normal.dot(point);
+        if (reach - closestDistance <= RELATIVE_TOLERANCE * std::max(1.0f, std::fabs(reach)) || count == MAX_POLYTOPE_VERTICES)
+        {
+            break;
+        }
+
+        std::copy_backward(polytope.begin() + closestEdge + 1, polytope.begin() + count, polytope.begin() + count + 1);
+        polytope[closestEdge + 1] = point;
+        count++;
+    }
+
+    translation = -normal * std::max(depth, 0.0f);
+    return true;
+}
@@ -7,43 +7,267 @@
  * @date 12-01-2024
  */
 
-#pragma once
-
 #include "geometry/Polygon.hpp"
 
+#include <cmath>
+#include <utility>
+
+#include "geometry/Affine2.hpp"
+#include "geometry/ConvexHull.hpp"
+#include "geometry/Triangulator.hpp"
+#include "geometry/internal/common.hpp"
+
 using namespace geometry;
 
 Polygon::Polygon(const Polygon& src)
-    : vertices(src.vertices)
+    : vertices(src.vertices), edgeNormals(src.edgeNormals), doubleSignedArea(src.doubleSignedArea), edgeLenghtSum(src.edgeLenghtSum),
+    momentX(src.momentX), momentY(src.momentY), vertexSum(src.vertexSum), minCorner(src.minCorner), maxCorner(src.maxCorner)
 {
 
 }
 
-double Polygon::area() const
+Polygon::Polygon(Polygon&& src) noexcept
+    : vertices(std::move(src.vertices)), edgeNormals(std::move(src.edgeNormals)), doubleSignedArea(src.doubleSignedArea), edgeLenghtSum(src.edgeLenghtSum),
+    momentX(src.momentX), momentY(src.momentY), vertexSum(src.vertexSum), minCorner(src.minCorner), maxCorner(src.maxCorner)
 {
+    src.resetProperties(Vector2());
+}
 
+double Polygon::area() const
+{
+    return std::fabs(doubleSignedArea) / 2;
 }
 
 double Polygon::perimeter() const
 {
-
+    return edgeLenghtSum;
 }
 
 Vector2 Polygon::center() const
 {
-    float sumX = 0.0f, sumY = 0.0f;
-    int numberOfVertices = vertices.size();
-    
+    if (std::fabs(doubleSignedArea) <= FLOAT_EPSILON)
+    {
+        return vertexSum / static_cast<float>(vertices.size());
+    }
+
+    // The centroid is the sum of the moments divided by 6 times the signed area.
+    const double scale = 1.0 / (3.0 * doubleSignedArea);
+    return Vector2(static_cast<float>(momentX * scale), static_cast<float>(momentY * scale));
+}
+
+Rect Polygon::bounds() const
+{
+    return Rect(minCorner.x, minCorner.y, maxCorner.x - minCorner.x, maxCorner.y - minCorner.y);
+}
+
+Vector2 Polygon::support(const Vector2& direction) const
+{
+    const Vector2* farthest = &vertices[0];
+    float farthestProjection = direction.dot(vertices[0]);
+
     for (const auto& vertex : vertices)
     {
-        sumX += vertex.x;
-        sumY += vertex.y;
+        const float projection = direction.dot(vertex);
+        if (projection > farthestProjection)
+        {
+            farthest = &vertex;
+            farthestProjection = projection;
+        }
+    }
+
+    return *farthest;
+}
+
+void Polygon::moveTo(const Vector2& newPos)
+{
+    moveWith(newPos - center());
+}
+
+void Polygon::moveWith(const Vector2& changePos)
+{
+    for (auto& vertex : vertices)
+    {
+        vertex += changePos;
+    }
+
+    // The area and perimeter do not change, the centroid moves with the polygon so its moments
+    // grow by 6 * area * changePos.
+    momentX += 3.0 * doubleSignedArea * changePos.x;
+    momentY += 3.0 * doubleSignedArea * changePos.y;
+    vertexSum += changePos * static_cast<float>(vertices.size());
+    minCorner += changePos;
+    maxCorner += changePos;
+}
+
+Polygon& Polygon::addVertex(const Vector2 vertex)
+{
+    throwIfMovedFrom();
+
+    const Vector2 first = vertices.front(), last = vertices.back();
+    vertices.push_back(vertex);
+
+    // Only the edge into the new vertex and the closing edge change.
+    accumulateEdge(last, first, -1.0);
+    accumulateEdge(last, vertex, 1.0);
+    accumulateEdge(vertex, first, 1.0);
+    vertexSum += vertex;
+    minCorner.moveTo(std::fmin(minCorner.x, vertex.x), std::fmin(minCorner.y, vertex.y));
+    maxCorner.moveTo(std::fmax(maxCorner.x, vertex.x), std::fmax(maxCorner.y, vertex.y));
+
+    edgeNormals.emplace_back();
+    updateEdgeNormal(vertices.size() - 2);
+    updateEdgeNormal(vertices.size() - 1);
+    return *this;
+}
+
+Polygon& Polygon::transform(const Affine2& transform)
+{
+    throwIfMovedFrom();
+
+    const std::size_t count = vertices.size();
+    edgeNormals.resize(count);
+
+    // The end of every edge is transformed just before the edge is measured, so the vertices, the
+    // normals and the running sums are all brought up to date in a single pass over the vertices.
+    vertices[0] = transform.apply(vertices[0]);
+    resetProperties(vertices[0]);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (i + 1 < count)
+        {
+            vertices[i + 1] = transform.apply(vertices[i + 1]);
+        }
+        accumulateVertex(i);
+    }
+    return *this;
+}
+
+const Polygon::VertexStorage& Polygon::getVertices() const
+{
+    return vertices;
+}
+
+const Polygon::VertexStorage& Polygon::getEdgeNormals() const
+{
+    return edgeNormals;
+}
+
+Polygon& Polygon::putVerticesInOrder(ThreadPool* pool)
+{
+    std::vector<Vector2> hull;
+    if (ConvexHull::compute(vertices.data(), vertices.size(), hull, pool) < 3)
+    {
+        throw std::runtime_error("The vertices of the polygon are collinear!");
+    }
+
+    vertices.assign(hull.begin(), hull.end());
+    updateProperties();
+    return *this;
+}
+
+std::size_t Polygon::triangulate(std::vector<std::uint32_t>& indices) const
+{
+    if (vertices.size() < 3)
+    {
+        throw std::runtime_error("A polygon needs at least 3 vertices to be triangulated!");
+    }
+
+    return Triangulator::triangulate(vertices.data(), vertices.size(), indices);
+}
+
+void Polygon::updateEdgeNormal(std::size_t edge)
+{
+    const Vector2 direction = vertices[(edge + 1) % vertices.size()] - vertices[edge];
+    const float lenght = direction.lenght();
+
+    edgeNormals[edge] = (lenght > FLOAT_EPSILON) ? Vector2(direction.y / lenght, -direction.x / lenght) : Vector2();
+}
+
+Polygon& Polygon::operator =(const Polygon& other)
+{
+    vertices = other.vertices;
+    edgeNormals = other.edgeNormals;
+    doubleSignedArea = other.doubleSignedArea;
+    edgeLenghtSum = other.edgeLenghtSum;
+    momentX = other.momentX;
+    momentY = other.momentY;
+    vertexSum = other.vertexSum;
+    minCorner = other.minCorner;
+    maxCorner = other.maxCorner;
+
+    return *this;
+}
+
+Polygon& Polygon::operator =(Polygon&& other) noexcept
+{
+    if (this == &other)
+    {
+        return *this;
     }
 
-    return Vector2(sumX / numberOfVertices, sumY / numberOfVertices);
+    vertices = std::move(other.vertices);
+    edgeNormals = std::move(other.edgeNormals);
+    doubleSignedArea = other.doubleSignedArea;
+    edgeLenghtSum = other.edgeLenghtSum;
+    momentX = other.momentX;
+    momentY = other.momentY;
+    vertexSum = other.vertexSum;
+    minCorner = other.minCorner;
+    maxCorner = other.maxCorner;
+    other.resetProperties(Vector2());
+
+    return *this;
+}
+
+float Polygon::accumulateEdge(const Vector2& start, const Vector2& end, double sign)
+{
+    const double cross = static_cast<double>(start.x) * end.y - static_cast<double>(start.y) * end.x;
+    const float lenght = (end - start).lenght();
+
+    doubleSignedArea += sign * cross;
+    edgeLenghtSum += sign * lenght;
+    momentX += sign * (static_cast<double>(start.x) + end.x) * cross;
+    momentY += sign * (static_cast<double>(start.y) + end.y) * cross;
+    return lenght;
 }
 
-void Polygon::putVerticesInOrder()
+void Polygon::accumulateVertex(std::size_t index)
 {
+    const Vector2& vertex = vertices[index];
+    const Vector2& next = vertices[(index + 1 == vertices.size()) ? 0 : index + 1];
+
+    // The lenght of the edge serves both the perimeter and the normal
+    const float lenght = accumulateEdge(vertex, next, 1.0);
+    const Vector2 direction = next - vertex;
+    edgeNormals[index] = (lenght > FLOAT_EPSILON) ? Vector2(direction.y / lenght, -direction.x / lenght) : Vector2();
 
+    vertexSum += vertex;
+    minCorner.moveTo(std::fmin(minCorner.x, vertex.x), std::fmin(minCorner.y, vertex.y));
+    maxCorner.moveTo(std::fmax(maxCorner.x, vertex.x), std::fmax(maxCorner.y, vertex.y));
+}
+
+void Polygon::throwIfMovedFrom() const
+{
+    if (vertices.empty())
+    {
+        throw std::runtime_error("The polygon was moved from and has no vertices!");
+    }
+}
+
+void Polygon::resetProperties(const Vector2& firstVertex)
+{
+    doubleSignedArea = edgeLenghtSum = momentX = momentY = 0.0;
+    vertexSum = Vector2();
+    minCorner = maxCorner = firstVertex;
+}
+
+void Polygon::updateProperties()
+{
+    edgeNormals.resize(vertices.size());
+    resetProperties(vertices.front());
+
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        accumulateVertex(i);
+    }
 }
\ No newline at end of file
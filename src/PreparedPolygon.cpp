@@ -0,0 +1,236 @@
+/**
+ * @file PreparedPolygon.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::PreparedPolygon class
+ * 
+ * A point P of the cell whose bottom right corner is C = (X, Y) is inside the polygon if C is inside
+ * and the path from C straight up to (X, P.y), then left to P, crosses the boundary an even number of
+ * times. Both legs lie in the cell, so only its edges can cross them. The crossings are decided with
+ * orientation tests and the rule of the usual crossing test, as if every point were moved right by an
+ * infinitesimal and up by a smaller one, so points on edges, vertices and cell lines need no special case.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/PreparedPolygon.hpp"
+
+#include <algorithm>
+
+using namespace geometry;
+
+namespace {
+    /**
+     * Positive if @p point is left of the line going from @p start to @p end.
+     */
+    double orientation(const Vector2& start, const Vector2& end, float pointX, float pointY)
+    {
+        return (static_cast<double>(end.x) - start.x) * (static_cast<double>(pointY) - start.y)
+            - (static_cast<double>(end.y) - start.y) * (static_cast<double>(pointX) - start.x);
+    }
+
+    /**
+     * Checks if the edge crosses the horizontal line through y at an x in (fromX, toX].
+     */
+    bool crossesRow(const Vector2& first, const Vector2& second, float y, float fromX, float toX, bool fromInfinity)
+    {
+        if ((first.y > y) == (second.y > y))
+        {
+            return false;
+        }
+
+        const Vector2& lower = (first.y < second.y) ? first : second;
+        const Vector2& upper = (first.y < second.y) ? second : first;
+        return (fromInfinity || orientation(lower, upper, fromX, y) > 0.0) && orientation(lower, upper, toX, y) <= 0.0;
+    }
+
+    /**
+     * Checks if the edge crosses the vertical line through x at a y in (fromY, toY].
+     */
+    bool crossesColumn(const Vector2& first, const Vector2& second, float x, float fromY, float toY)
+    {
+        if ((first.x > x) == (second.x > x))
+        {
+            return false;
+        }
+
+        // Where the edge meets the line exactly, it passes above the point when it goes up to the right.
+        const Vector2& left = (first.x < second.x) ? first : second;
+        const Vector2& right = (first.x < second.x) ? second : first;
+        const bool risesRight = right.y > left.y;
+
+        const double toOrientation = orientation(left, right, x, toY);
+        const double fromOrientation = orientation(left, right, x, fromY);
+        return (toOrientation > 0.0 || (toOrientation == 0.0 && !risesRight))
+            && (fromOrientation < 0.0 || (fromOrientation == 0.0 && risesRight));
+    }
+}
+
+PreparedPolygon::PreparedPolygon(const Polygon& polygon)
+{
+    const auto& vertices = polygon.getVertices();
+    const Rect bounds = polygon.bounds();
+
+    // The box of the grid, its cells are chosen once the edges are known
+    const float minX = bounds.getPosition().x;
+    const float minY = bounds.getPosition().y;
+    grid.reset(minX, minY, minX + bounds.getWidth(), minY + bounds.getHeight(), 1, 1);
+
+    std::vector<Edge> edges;
+    edges.reserve(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        const Vector2 start = vertices[i], end = vertices[(i + 1) % vertices.size()];
+        if (start != end)
+        {
+            edges.push_back({start, end});
+        }
+    }
+
+    // Cells about as wide as they are high, a few per edge
+    std::size_t columnCount, rowCount;
+    internal::UniformGrid::fit(bounds.getWidth(), bounds.getHeight(),
+        static_cast<double>(std::max<std::size_t>(edges.size(), 1) * CELLS_PER_EDGE), columnCount, rowCount);
+
+    // Polygons with long edges, like stars, get coarser grids until the entries fit
+    const std::size_t maxEntries = std::max<std::size_t>(edges.size(), 1) * MAX_ENTRIES_PER_EDGE;
+    while (!buildGrid(edges, columnCount, rowCount, maxEntries))
+    {
+        columnCount = std::max<std::size_t>(columnCount * 7 / 10, 1);
+        rowCount = std::max<std::size_t>(rowCount * 7 / 10, 1);
+    }
+}
+
+bool PreparedPolygon::contains(const Vector2& point) const
+{
+    if (point.x < grid.minX || point.x > grid.maxX || point.y < grid.minY || point.y >= grid.maxY)
+    {
+        return false;
+    }
+
+    const std::size_t column = grid.columnOf(point.x);
+    const std::size_t row = grid.rowOf(point.y);
+    const std::size_t cell = row * grid.columns + column;
+
+    const float cornerX = grid.columnLines[column + 1];
+    const float cornerY = grid.rowLines[row];
+
+    bool inside = cornerInside[cell] != 0;
+    for (std::size_t i = cellStarts[cell]; i < cellStarts[cell + 1]; i++)
+    {
+        const Edge& edge = cellEdges[i];
+        if (crossesColumn(edge.start, edge.end, cornerX, cornerY, point.y))
+        {
+            inside = !inside;
+        }
+        if (crossesRow(edge.start, edge.end, point.y, point.x, cornerX, false))
+        {
+            inside = !inside;
+        }
+    }
+
+    return inside;
+}
+
+std::size_t PreparedPolygon::contains(const Vector2* points, std::size_t count, std::vector<std::uint8_t>& results, ThreadPool* pool) const
+{
+    results.resize(count);
+
+    auto run = [this, points, &results](std::size_t begin, std::size_t end) {
+        std::size_t inside = 0;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            results[i] = contains(points[i]) ? 1 : 0;
+            inside += results[i];
+        }
+        return inside;
+    };
+
+    if (pool == nullptr)
+    {
+        return run(0, count);
+    }
+
+    std::vector<std::size_t> insidePerSlot(pool->getThreadCount(), 0);
+    pool->parallelFor(count, 4096, [&run, &insidePerSlot](std::size_t begin, std::size_t end, std::size_t slot) {
+        insidePerSlot[slot] += run(begin, end);
+    });
+
+    std::size_t inside = 0;
+    for (std::size_t slotInside : insidePerSlot)
+    {
+        inside += slotInside;
+    }
+    return inside;
+}
+
+std::size_t PreparedPolygon::contains(const std::vector<Vector2>& points, std::vector<std::uint8_t>& results, ThreadPool* pool) const
+{
+    return contains(points.data(), points.size(), results, pool);
+}
+
+std::size_t PreparedPolygon::getCellCount() const
+{
+    return grid.cellCount();
+}
+
+std::size_t PreparedPolygon::getEntryCount() const
+{
+    return cellEdges.size();
+}
+
+bool PreparedPolygon::buildGrid(const std::vector<Edge>& edges, std::size_t columnCount, std::size_t rowCount, std::size_t maxEntries)
+{
+    grid.reset(grid.minX, grid.minY, grid.maxX, grid.maxY, columnCount, rowCount);
+
+    // Two passes: count the edges of every cell, then write them contiguously.
+    const std::size_t cellCount = grid.cellCount();
+    cellStarts.assign(cellCount + 1, 0);
+    std::size_t entryCount = 0;
+    for (const auto& edge : edges)
+    {
+        grid.forEachCell(edge.start, edge.end, [&](std::size_t cell) {
+            cellStarts[cell + 1]++;
+            entryCount++;
+        });
+        if (entryCount > maxEntries && cellCount > 1)
+        {
+            return false;
+        }
+    }
+    for (std::size_t cell = 0; cell < cellCount; cell++)
+    {
+        cellStarts[cell + 1] += cellStarts[cell];
+    }
+
+    cellEdges.resize(entryCount);
+    std::vector<std::size_t> cursors(cellStarts.begin(), cellStarts.end() - 1);
+    for (const auto& edge : edges)
+    {
+        grid.forEachCell(edge.start, edge.end, [&](std::size_t cell) {
+            cellEdges[cursors[cell]++] = edge;
+        });
+    }
+
+    // The corners of a row are walked from the left of the polygon, every crossing of the bottom line
+    // of the row between two corners belongs to an edge of the cell between them.
+    cornerInside.assign(cellCount, 0);
+    for (std::size_t row = 0; row < grid.rows; row++)
+    {
+        bool inside = false;
+        for (std::size_t column = 0; column < grid.columns; column++)
+        {
+            const std::size_t cell = row * grid.columns + column;
+            for (std::size_t i = cellStarts[cell]; i < cellStarts[cell + 1]; i++)
+            {
+                const Edge& edge = cellEdges[i];
+                if (crossesRow(edge.start, edge.end, grid.rowLines[row], grid.columnLines[column], grid.columnLines[column + 1], column == 0))
+                {
+                    inside = !inside;
+                }
+            }
+            cornerInside[cell] = inside ? 1 : 0;
+        }
+    }
+    return true;
+}
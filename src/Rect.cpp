@@ -42,6 +42,16 @@ Vector2 Rect::center() const
     return position + Vector2(width / 2, height / 2);
 }
 
+Rect Rect::bounds() const
+{
+    return *this;
+}
+
+Vector2 Rect::support(const Vector2& direction) const
+{
+    return Vector2((direction.x >= 0.0f) ? position.x + width : position.x, (direction.y >= 0.0f) ? position.y + height : position.y);
+}
+
 void Rect::moveTo(const Vector2& newPos)
 {
     position = newPos;
@@ -59,7 +69,7 @@ Rect&Rect::scaleWith(float factor)
     return *this;
 }
 
-Rect&Rect::resize(double width, double height)
+Rect&Rect::resize(float width, float height)
 {
     this->width = width;
     this->height = height;
@@ -96,6 +106,12 @@ bool Rect::isValid() const
     return (this->width > FLOAT_EPSILON) && (this->height > FLOAT_EPSILON);  
 }
 
+bool Rect::overlaps(const Rect& other) const
+{
+    return (this->position.x <= other.position.x + other.width) && (other.position.x <= this->position.x + this->width)
+        && (this->position.y <= other.position.y + other.height) && (other.position.y <= this->position.y + this->height);
+}
+
 Vector2 Rect::getPosition() const
 {
     return Vector2(this->position);
@@ -0,0 +1,91 @@
+/**
+ * @file RectArray.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::RectArray class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/RectArray.hpp"
+
+using namespace geometry;
+
+RectArray::RectArray(const std::vector<Rect>& rects)
+{
+    reserve(rects.size());
+    for (const auto& rect : rects)
+    {
+        push_back(rect);
+    }
+}
+
+std::size_t RectArray::size() const
+{
+    return minXs.size();
+}
+
+bool RectArray::empty() const
+{
+    return minXs.empty();
+}
+
+Rect RectArray::get(std::size_t index) const
+{
+    return Rect(minXs[index], minYs[index], maxXs[index] - minXs[index], maxYs[index] - minYs[index]);
+}
+
+void RectArray::reserve(std::size_t capacity)
+{
+    minXs.reserve(capacity);
+    minYs.reserve(capacity);
+    maxXs.reserve(capacity);
+    maxYs.reserve(capacity);
+}
+
+void RectArray::clear()
+{
+    minXs.clear();
+    minYs.clear();
+    maxXs.clear();
+    maxYs.clear();
+}
+
+void RectArray::push_back(const Rect& rect)
+{
+    Vector2 position = rect.getPosition();
+    minXs.push_back(position.x);
+    minYs.push_back(position.y);
+    maxXs.push_back(position.x + rect.getWidth());
+    maxYs.push_back(position.y + rect.getHeight());
+}
+
+RectArray& RectArray::set(std::size_t index, const Rect& rect)
+{
+    Vector2 position = rect.getPosition();
+    minXs[index] = position.x;
+    minYs[index] = position.y;
+    maxXs[index] = position.x + rect.getWidth();
+    maxYs[index] = position.y + rect.getHeight();
+    return *this;
+}
+
+const float* RectArray::minXData() const
+{
+    return minXs.data();
+}
+
+const float* RectArray::minYData() const
+{
+    return minYs.data();
+}
+
+const float* RectArray::maxXData() const
+{
+    return maxXs.data();
+}
+
+const float* RectArray::maxYData() const
+{
+    return maxYs.data();
+}
@@ -0,0 +1,218 @@
+/**
+ * @file SeparatingAxis.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::SeparatingAxis and
+ * @c geometry::SeparatingAxisCache classes
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/SeparatingAxis.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "geometry/internal/common.hpp"
+
+using namespace geometry;
+
+namespace {
+    const std::array<Vector2, 2> RECT_NORMALS = {Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f)};
+
+    void project(const ConvexView& shape, const Vector2& axis, float& min, float& max)
+    {
+        const Vector2* vertices = shape.getVertices();
+
+        min = max = axis.dot(vertices[0]);
+        for (std::size_t i = 1; i < shape.getVertexCount(); i++)
+        {
+            const float projection = axis.dot(vertices[i]);
+            min = std::min(min, projection);
+            max = std::max(max, projection);
+        }
+    }
+
+    /**
+     * Tries the normals of @p owner as separating axes. When none separates, @p depth and @p translation
+     * are lowered to the smallest push out of @p other seen so far.
+     */
+    bool searchAxes(const ConvexView& owner, const ConvexView& first, const ConvexView& second, Vector2& separatingAxis, float& depth, Vector2& translation)
+    {
+        const Vector2* normals = owner.getNormals();
+
+        for (std::size_t i = 0; i < owner.getNormalCount(); i++)
+        {
+            const Vector2& axis = normals[i];
+            if (axis.isNull())
+            {
+                continue;
+            }
+
+            float firstMin, firstMax, secondMin, secondMax;
+            project(first, axis, firstMin, firstMax);
+            project(second, axis, secondMin, secondMax);
+
+            if (firstMax < secondMin || secondMax < firstMin)
+            {
+                separatingAxis = axis;
+                return true;
+            }
+
+            // The first shape leaves either backwards, past the second's min, or forwards, past its max.
+            const float backwards = firstMax - secondMin;
+            const float forwards = secondMax - firstMin;
+            if (backwards < depth)
+            {
+                depth = backwards;
+                translation = -axis * backwards;
+            }
+            if (forwards < depth)
+            {
+                depth = forwards;
+                translation = axis * forwards;
+            }
+        }
+
+        return false;
+    }
+
+    bool runTest(const ConvexView& first, const ConvexView& second, Vector2& separatingAxis, Vector2& translation)
+    {
+        float depth = std::numeric_limits<float>::max();
+        Vector2 smallest;
+
+        if (searchAxes(first, first, second, separatingAxis, depth, smallest) || searchAxes(second, first, second, separatingAxis, depth, smallest))
+        {
+            return false;
+        }
+
+        translation = smallest;
+        return true;
+    }
+
+    std::uint64_t keyOf(IndexPair pair)
+    {
+        const std::uint32_t low = std::min(pair.first, pair.second);
+        const std::uint32_t high = std::max(pair.first, pair.second);
+
+        return (static_cast<std::uint64_t>(low) << 32) | high;
+    }
+}
+
+ConvexView::ConvexView(const Polygon& polygon)
+    : vertices(polygon.getVertices().data()), vertexCount(polygon.getVertices().size()),
+    normals(polygon.getEdgeNormals().data()), normalCount(polygon.getEdgeNormals().size())
+{
+
+}
+
+ConvexView::ConvexView(const Rect& rect)
+    : vertexCount(4), normals(RECT_NORMALS.data()), normalCount(RECT_NORMALS.size())
+{
+    const Vector2 position = rect.getPosition();
+    const float width = rect.getWidth(), height = rect.getHeight();
+
+    ownVertices = {position, position + Vector2(width, 0.0f), position + Vector2(width, height), position + Vector2(0.0f, height)};
+    vertices = ownVertices.data();
+}
+
+ConvexView::ConvexView(const Triangle& triangle)
+    : vertices(triangle.getVertices().data()), vertexCount(3), normals(ownNormals.data()), normalCount(3)
+{
+    for (std::size_t edge = 0; edge < 3; edge++)
+    {
+        const Vector2 direction = vertices[(edge + 1) % 3] - vertices[edge];
+        const float lenght = direction.lenght();
+
+        ownNormals[edge] = (lenght > FLOAT_EPSILON) ? Vector2(direction.y / lenght, -direction.x / lenght) : Vector2();
+    }
+}
+
+const Vector2* ConvexView::getVertices() const
+{
+    return vertices;
+}
+
+std::size_t ConvexView::getVertexCount() const
+{
+    return vertexCount;
+}
+
+const Vector2* ConvexView::getNormals() const
+{
+    return normals;
+}
+
+std::size_t ConvexView::getNormalCount() const
+{
+    return normalCount;
+}
+
+bool SeparatingAxis::collide(const ConvexView& first, const ConvexView& second, Vector2& translation)
+{
+    Vector2 separatingAxis;
+    return runTest(first, second, separatingAxis, translation);
+}
+
+bool SeparatingAxis::findSeparatingAxis(const ConvexView& first, const ConvexView& second, Vector2& axis)
+{
+    Vector2 translation;
+    return !runTest(first, second, axis, translation);
+}
+
+bool SeparatingAxis::separates(const ConvexView& first, const ConvexView& second, const Vector2& axis)
+{
+    float firstMin, firstMax, secondMin, secondMax;
+    project(first, axis, firstMin, firstMax);
+    project(second, axis, secondMin, secondMax);
+
+    return firstMax < secondMin || secondMax < firstMin;
+}
+
+bool SeparatingAxisCache::collide(IndexPair pair, const ConvexView& first, const ConvexView& second, Vector2& translation)
+{
+    const std::uint64_t key = keyOf(pair);
+
+    auto cached = separatingAxes.find(key);
+    if (cached != separatingAxes.end() && SeparatingAxis::separates(first, second, cached->second))
+    {
+        return false;
+    }
+
+    Vector2 separatingAxis;
+    if (!runTest(first, second, separatingAxis, translation))
+    {
+        if (cached != separatingAxes.end())
+        {
+            cached->second = separatingAxis;
+        }
+        else
+        {
+            separatingAxes.emplace(key, separatingAxis);
+        }
+        return false;
+    }
+
+    if (cached != separatingAxes.end())
+    {
+        separatingAxes.erase(cached);
+    }
+    return true;
+}
+
+void SeparatingAxisCache::forget(IndexPair pair)
+{
+    separatingAxes.erase(keyOf(pair));
+}
+
+void SeparatingAxisCache::clear()
+{
+    separatingAxes.clear();
+}
+
+std::size_t SeparatingAxisCache::size() const
+{
+    return separatingAxes.size();
+}
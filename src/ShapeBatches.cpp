@@ -0,0 +1,84 @@
+/**
+ * @file ShapeBatches.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::ShapeBatches class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ShapeBatches.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+using namespace geometry;
+
+void ShapeBatches::add(const AnyShape& shape)
+{
+    std::visit([this](const auto& concrete) { add(concrete); }, shape);
+}
+
+std::size_t ShapeBatches::size() const
+{
+    std::size_t count = 0;
+    visitBatches([&count](const auto& batch) { count += batch.size(); });
+    return count;
+}
+
+void ShapeBatches::clear()
+{
+    visitBatches([](auto& batch) { batch.clear(); });
+}
+
+double ShapeBatches::totalArea() const
+{
+    double total = 0.0;
+    forEach([&total](const auto& shape) {
+        using Concrete = std::decay_t<decltype(shape)>;
+        total += shape.Concrete::area();
+    });
+    return total;
+}
+
+double ShapeBatches::totalPerimeter() const
+{
+    double total = 0.0;
+    forEach([&total](const auto& shape) {
+        using Concrete = std::decay_t<decltype(shape)>;
+        total += shape.Concrete::perimeter();
+    });
+    return total;
+}
+
+Rect ShapeBatches::totalBounds() const
+{
+    float minX = std::numeric_limits<float>::max(), minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest(), maxY = std::numeric_limits<float>::lowest();
+
+    forEach([&](const auto& shape) {
+        using Concrete = std::decay_t<decltype(shape)>;
+        const Rect bounds = shape.Concrete::bounds();
+        const Vector2 position = bounds.getPosition();
+
+        minX = std::min(minX, position.x);
+        minY = std::min(minY, position.y);
+        maxX = std::max(maxX, position.x + bounds.getWidth());
+        maxY = std::max(maxY, position.y + bounds.getHeight());
+    });
+
+    if (minX > maxX)
+    {
+        return Rect();
+    }
+    return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+void ShapeBatches::moveWith(const Vector2& changePos)
+{
+    forEach([&changePos](auto& shape) {
+        using Concrete = std::decay_t<decltype(shape)>;
+        shape.Concrete::moveWith(changePos);
+    });
+}
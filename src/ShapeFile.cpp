@@ -0,0 +1,293 @@
+/**
+ * @file ShapeFile.cpp
+ *
+ * @brief Implementation of the methods from the @c geometry::ShapeFileWriter and @c geometry::MappedShapeFile classes
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ShapeFile.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace geometry;
+
+namespace {
+    constexpr char MAGIC[8] = {'G', 'E', 'O', 'S', 'H', 'A', 'P', 'E'};
+
+    /**
+     * Maps the whole file read-only, filling @p size.
+     */
+    void* mapFile(const std::string& path, std::size_t& size)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("The shape file could not be opened!");
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(ShapeFileHeader)))
+        {
+            CloseHandle(file);
+            throw std::runtime_error("The file is too short to be a shape file!");
+        }
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        // The view keeps the mapping alive, so both handles can be closed right away
+        HANDLE mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* mapping = (mappingHandle != nullptr) ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mappingHandle != nullptr)
+        {
+            CloseHandle(mappingHandle);
+        }
+        CloseHandle(file);
+#else
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("The shape file could not be opened!");
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(ShapeFileHeader)))
+        {
+            close(descriptor);
+            throw std::runtime_error("The file is too short to be a shape file!");
+        }
+        size = static_cast<std::size_t>(status.st_size);
+
+        // The mapping outlives the descriptor
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+        }
+#endif
+        if (mapping == nullptr)
+        {
+            throw std::runtime_error("The shape file could not be mapped!");
+        }
+        return mapping;
+    }
+
+    void unmapFile(void* mapping, std::size_t size)
+    {
+#ifdef _WIN32
+        (void)size;
+        UnmapViewOfFile(mapping);
+#else
+        munmap(mapping, size);
+#endif
+    }
+
+    /**
+     * Checks that count items of the given size starting at offset fit in the file, without overflowing.
+     */
+    bool fits(std::uint64_t offset, std::uint64_t count, std::uint64_t itemSize, std::size_t fileSize)
+    {
+        return offset <= fileSize && count <= (fileSize - offset) / itemSize && offset % 8 == 0;
+    }
+}
+
+ShapeFileWriter::ShapeFileWriter(const std::string& path)
+    : stream(path, std::ios::binary | std::ios::trunc), vertexCount(0), finished(false)
+{
+    if (!stream)
+    {
+        throw std::runtime_error("The shape file could not be opened for writing!");
+    }
+
+    // The header is rewritten by finish(), once the counts are known
+    const ShapeFileHeader placeholder = {};
+    stream.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+}
+
+ShapeFileWriter& ShapeFileWriter::add(const Rect& rect)
+{
+    const Vector2 corners[2] = {rect.getPosition(), Vector2(rect.getWidth(), rect.getHeight())};
+    addShape(ShapeType::Rect, corners, 2);
+    return *this;
+}
+
+ShapeFileWriter& ShapeFileWriter::add(const Polygon& polygon)
+{
+    return addPolygon(polygon.getVertices().data(), polygon.getVertices().size());
+}
+
+ShapeFileWriter& ShapeFileWriter::addPolygon(const Vector2* vertices, std::size_t count)
+{
+    if (count < 3)
+    {
+        throw std::invalid_argument("A polygon needs at least 3 vertices!");
+    }
+
+    addShape(ShapeType::Polygon, vertices, count);
+    return *this;
+}
+
+void ShapeFileWriter::finish()
+{
+    if (finished)
+    {
+        throw std::runtime_error("The shape file was already finished!");
+    }
+    finished = true;
+
+    ShapeFileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = ShapeFileHeader::VERSION;
+    header.byteOrderMark = ShapeFileHeader::BYTE_ORDER_MARK;
+    header.shapeCount = table.size();
+    header.vertexCount = vertexCount;
+    header.vertexOffset = sizeof(ShapeFileHeader);
+    header.tableOffset = sizeof(ShapeFileHeader) + vertexCount * sizeof(Vector2);
+
+    stream.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(ShapeRecord)));
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.close();
+
+    if (!stream)
+    {
+        throw std::runtime_error("The shape file could not be written!");
+    }
+}
+
+std::size_t ShapeFileWriter::getShapeCount() const
+{
+    return table.size();
+}
+
+void ShapeFileWriter::addShape(ShapeType type, const Vector2* vertices, std::size_t count)
+{
+    if (finished)
+    {
+        throw std::runtime_error("The shape file was already finished!");
+    }
+
+    table.push_back({type, static_cast<std::uint32_t>(count), vertexCount});
+    vertexCount += count;
+    stream.write(reinterpret_cast<const char*>(vertices), static_cast<std::streamsize>(count * sizeof(Vector2)));
+}
+
+MappedShapeFile::MappedShapeFile(const std::string& path)
+    : mapping(nullptr), mappingSize(0), header(nullptr), table(nullptr), vertices(nullptr)
+{
+    mapping = mapFile(path, mappingSize);
+    const char* bytes = static_cast<const char*>(mapping);
+    header = reinterpret_cast<const ShapeFileHeader*>(bytes);
+
+    const char* problem = nullptr;
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        problem = "The file is not a shape file!";
+    }
+    else if (header->byteOrderMark != ShapeFileHeader::BYTE_ORDER_MARK)
+    {
+        problem = "The shape file was written with another byte order!";
+    }
+    else if (header->version != ShapeFileHeader::VERSION)
+    {
+        problem = "The version of the shape file is not supported!";
+    }
+    else if (!fits(header->vertexOffset, header->vertexCount, sizeof(Vector2), mappingSize)
+        || !fits(header->tableOffset, header->shapeCount, sizeof(ShapeRecord), mappingSize))
+    {
+        problem = "The shape file is truncated!";
+    }
+
+    if (problem != nullptr)
+    {
+        unmap();
+        throw std::runtime_error(problem);
+    }
+
+    vertices = reinterpret_cast<const Vector2*>(bytes + header->vertexOffset);
+    table = reinterpret_cast<const ShapeRecord*>(bytes + header->tableOffset);
+}
+
+MappedShapeFile::~MappedShapeFile()
+{
+    unmap();
+}
+
+std::size_t MappedShapeFile::size() const
+{
+    return static_cast<std::size_t>(header->shapeCount);
+}
+
+ShapeType MappedShapeFile::getType(std::size_t shape) const
+{
+    if (shape >= size())
+    {
+        throw std::out_of_range("There is no shape with this index in the file!");
+    }
+    return table[shape].type;
+}
+
+PolygonView MappedShapeFile::getPolygon(std::size_t shape) const
+{
+    const ShapeRecord& polygon = record(shape, ShapeType::Polygon);
+    return PolygonView(vertices + polygon.firstVertex, polygon.vertexCount);
+}
+
+RectView MappedShapeFile::getRect(std::size_t shape) const
+{
+    const ShapeRecord& rect = record(shape, ShapeType::Rect);
+    if (rect.vertexCount != 2)
+    {
+        throw std::runtime_error("A rectangle in the shape file does not have 2 vertices!");
+    }
+    return RectView(vertices + rect.firstVertex);
+}
+
+const Vector2* MappedShapeFile::getVertexData() const
+{
+    return vertices;
+}
+
+std::size_t MappedShapeFile::getVertexCount() const
+{
+    return static_cast<std::size_t>(header->vertexCount);
+}
+
+const ShapeRecord& MappedShapeFile::record(std::size_t shape, ShapeType type) const
+{
+    if (getType(shape) != type)
+    {
+        throw std::invalid_argument("The shape has another type!");
+    }
+
+    // Records are checked as they are used, so opening a file does not touch the whole table
+    const ShapeRecord& found = table[shape];
+    if (found.firstVertex > header->vertexCount || found.vertexCount > header->vertexCount - found.firstVertex)
+    {
+        throw std::runtime_error("A shape points outside the vertex block of the file!");
+    }
+    return found;
+}
+
+void MappedShapeFile::unmap()
+{
+    if (mapping != nullptr)
+    {
+        unmapFile(mapping, mappingSize);
+        mapping = nullptr;
+    }
+}
@@ -0,0 +1,369 @@
+/**
+ * @file ShapeParser.cpp
+ *
+ * @brief Implementation of the methods from the @c geometry::ShapeParser class
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ShapeParser.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+
+using namespace geometry;
+
+namespace {
+    /**
+     * The part of a line left to parse.
+     */
+    struct Cursor {
+        const char* at;
+        const char* end;
+
+        void skipSpaces()
+        {
+            while (at < end && (*at == ' ' || *at == '\t' || *at == '\r'))
+            {
+                at++;
+            }
+        }
+
+        bool atEnd()
+        {
+            skipSpaces();
+            return at == end;
+        }
+
+        bool accept(char expected)
+        {
+            skipSpaces();
+            if (at < end && *at == expected)
+            {
+                at++;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Accepts a word in any case, @p word being upper case.
+         */
+        bool acceptWord(const char* word)
+        {
+            skipSpaces();
+            const std::size_t lenght = std::strlen(word);
+            if (static_cast<std::size_t>(end - at) < lenght)
+            {
+                return false;
+            }
+            for (std::size_t i = 0; i < lenght; i++)
+            {
+                const char letter = (at[i] >= 'a' && at[i] <= 'z') ? static_cast<char>(at[i] - 'a' + 'A') : at[i];
+                if (letter != word[i])
+                {
+                    return false;
+                }
+            }
+            at += lenght;
+            return true;
+        }
+
+        bool number(float& value)
+        {
+            skipSpaces();
+            if (at < end && *at == '+')
+            {
+                at++;
+            }
+            const std::from_chars_result result = std::from_chars(at, end, value);
+            if (result.ec != std::errc())
+            {
+                return false;
+            }
+            at = result.ptr;
+            return true;
+        }
+    };
+
+    [[noreturn]] void malformed(std::size_t line)
+    {
+        throw std::runtime_error("Malformed record on line " + std::to_string(line) + "!");
+    }
+
+    /**
+     * Parses "x y" pairs separated by commas up to the closing parenthesis.
+     */
+    bool parseRing(Cursor& cursor, std::vector<Vector2>& ring)
+    {
+        ring.clear();
+        if (!cursor.accept('('))
+        {
+            return false;
+        }
+        do
+        {
+            Vector2 point;
+            if (!cursor.number(point.x) || !cursor.number(point.y))
+            {
+                return false;
+            }
+            ring.push_back(point);
+        } while (cursor.accept(','));
+        return cursor.accept(')');
+    }
+
+    bool parseCsvLine(Cursor cursor, ParsedBatch& batch)
+    {
+        if (cursor.atEnd() || *cursor.at == '#')
+        {
+            return true;
+        }
+
+        Vector2 point;
+        if (!cursor.number(point.x) || !cursor.accept(',') || !cursor.number(point.y))
+        {
+            return false;
+        }
+        if (!cursor.atEnd() && *cursor.at != ',')
+        {
+            return false;
+        }
+        batch.points.push_back(point);
+        return true;
+    }
+
+    bool parseWktLine(Cursor cursor, ParsedBatch& batch, std::vector<Vector2>& ring)
+    {
+        if (cursor.atEnd())
+        {
+            return true;
+        }
+
+        if (cursor.acceptWord("POINT"))
+        {
+            if (cursor.acceptWord("EMPTY"))
+            {
+                return cursor.atEnd();
+            }
+
+            Vector2 point;
+            if (!cursor.accept('(') || !cursor.number(point.x) || !cursor.number(point.y) || !cursor.accept(')') || !cursor.atEnd())
+            {
+                return false;
+            }
+            batch.points.push_back(point);
+            return true;
+        }
+
+        if (!cursor.acceptWord("POLYGON"))
+        {
+            return false;
+        }
+        if (cursor.acceptWord("EMPTY"))
+        {
+            return cursor.atEnd();
+        }
+        if (!cursor.accept('(') || !parseRing(cursor, ring))
+        {
+            return false;
+        }
+
+        // The holes are parsed to check them, then dropped
+        std::vector<Vector2> hole;
+        while (cursor.accept(','))
+        {
+            if (!parseRing(cursor, hole))
+            {
+                return false;
+            }
+        }
+        if (!cursor.accept(')') || !cursor.atEnd())
+        {
+            return false;
+        }
+
+        if (ring.size() > 1 && ring.front() == ring.back())
+        {
+            ring.pop_back();
+        }
+        if (ring.size() < 3)
+        {
+            return false;
+        }
+
+        Polygon polygon(ring[0], ring[1], ring[2]);
+        for (std::size_t i = 3; i < ring.size(); i++)
+        {
+            polygon.addVertex(ring[i]);
+        }
+        batch.polygons.push_back(std::move(polygon));
+        return true;
+    }
+
+    void parseChunk(const std::string& text, std::size_t firstLine, InputFormat format, ParsedBatch& batch, std::vector<Vector2>& ring)
+    {
+        const char* at = text.data();
+        const char* const end = text.data() + text.size();
+        for (std::size_t line = firstLine; at < end; line++)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(at, '\n', static_cast<std::size_t>(end - at)));
+            if (lineEnd == nullptr)
+            {
+                lineEnd = end;
+            }
+
+            const Cursor cursor = {at, lineEnd};
+            const bool parsed = (format == InputFormat::CsvPoints) ? parseCsvLine(cursor, batch) : parseWktLine(cursor, batch, ring);
+            // The first line of a CSV file may be a header
+            if (!parsed && !(format == InputFormat::CsvPoints && line == 1))
+            {
+                malformed(line);
+            }
+
+            at = lineEnd + 1;
+        }
+    }
+}
+
+void ParsedBatch::clear()
+{
+    points.clear();
+    polygons.clear();
+    firstLine = 0;
+}
+
+ShapeParser::ShapeParser(ThreadPool* pool, std::size_t chunkSize)
+    : pool(pool), chunkSize(chunkSize)
+{
+    if (chunkSize == 0)
+    {
+        throw std::invalid_argument("The chunk size of a ShapeParser must be positive!");
+    }
+}
+
+std::size_t ShapeParser::parse(std::istream& input, InputFormat format, const Consumer& consumer)
+{
+    // Two groups of one chunk per thread are in flight, which bounds the memory whatever the size of
+    // the input: the pool parses one group while the calling thread consumes the other and refills it
+    const std::size_t threadCount = (pool != nullptr) ? pool->getThreadCount() : 1;
+    chunks.resize(2 * threadCount);
+    batches.resize(2 * threadCount);
+    rings.resize(threadCount);
+    carry.clear();
+
+    std::size_t nextLine = 1;
+    auto readGroup = [this, &input, &nextLine, threadCount](std::size_t first) {
+        std::size_t filled = 0;
+        while (filled < threadCount && readChunk(input, chunks[first + filled], nextLine))
+        {
+            filled++;
+        }
+        return filled;
+    };
+
+    auto parseGroup = [this, format](std::size_t first, std::size_t filled) {
+        auto parseChunks = [this, format, first](std::size_t begin, std::size_t end, std::size_t slot) {
+            for (std::size_t i = first + begin; i < first + end; i++)
+            {
+                batches[i].clear();
+                batches[i].firstLine = chunks[i].firstLine;
+                parseChunk(chunks[i].text, chunks[i].firstLine, format, batches[i], rings[slot]);
+            }
+        };
+        if (pool != nullptr && filled > 1)
+        {
+            pool->parallelFor(filled, 1, parseChunks);
+        }
+        else
+        {
+            parseChunks(0, filled, 0);
+        }
+    };
+
+    std::size_t parsed = 0;
+    auto consumeGroup = [this, &consumer, &parsed](std::size_t first, std::size_t filled) {
+        for (std::size_t i = first; i < first + filled; i++)
+        {
+            parsed += batches[i].points.size() + batches[i].polygons.size();
+            consumer(batches[i]);
+        }
+    };
+
+    std::size_t current = 0;
+    std::size_t filled = readGroup(current);
+    std::size_t other = threadCount;
+    std::size_t otherFilled = 0;
+    while (filled > 0)
+    {
+        // The pool is driven from a helper thread, so the calling thread is free to read and consume
+        std::future<void> parsing;
+        if (pool != nullptr)
+        {
+            parsing = std::async(std::launch::async, parseGroup, current, filled);
+        }
+
+        consumeGroup(other, otherFilled);
+        otherFilled = readGroup(other);
+
+        if (pool != nullptr)
+        {
+            parsing.get();
+        }
+        else
+        {
+            parseGroup(current, filled);
+        }
+
+        std::swap(current, other);
+        std::swap(filled, otherFilled);
+    }
+
+    // The last parsed group was swapped into the other slots
+    consumeGroup(other, otherFilled);
+    return parsed;
+}
+
+std::size_t ShapeParser::parseFile(const std::string& path, InputFormat format, const Consumer& consumer)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        throw std::runtime_error("The input file could not be opened!");
+    }
+    return parse(input, format, consumer);
+}
+
+bool ShapeParser::readChunk(std::istream& input, Chunk& chunk, std::size_t& nextLine)
+{
+    // The chunk starts with the unfinished line left over by the previous one
+    chunk.text.swap(carry);
+    carry.clear();
+
+    while (input)
+    {
+        const std::size_t oldSize = chunk.text.size();
+        chunk.text.resize(oldSize + chunkSize);
+        input.read(&chunk.text[oldSize], static_cast<std::streamsize>(chunkSize));
+        chunk.text.resize(oldSize + static_cast<std::size_t>(input.gcount()));
+
+        // Only the bytes just read can hold a line end
+        const auto lineEnd = std::find(chunk.text.rbegin(), chunk.text.rend() - static_cast<std::ptrdiff_t>(oldSize), '\n');
+        if (input && lineEnd != chunk.text.rend() - static_cast<std::ptrdiff_t>(oldSize))
+        {
+            const std::size_t kept = static_cast<std::size_t>(chunk.text.rend() - lineEnd);
+            carry.assign(chunk.text, kept, std::string::npos);
+            chunk.text.resize(kept);
+            break;
+        }
+    }
+
+    chunk.firstLine = nextLine;
+    nextLine += static_cast<std::size_t>(std::count(chunk.text.begin(), chunk.text.end(), '\n'));
+    return !chunk.text.empty();
+}
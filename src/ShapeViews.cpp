@@ -0,0 +1,135 @@
+/**
+ * @file ShapeViews.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::PolygonView and @c geometry::RectView classes
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ShapeViews.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/internal/Orientation.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+PolygonView::PolygonView(const Vector2* vertices, std::size_t count)
+    : vertices(vertices), count(count)
+{
+
+}
+
+double PolygonView::area() const
+{
+    return std::fabs(doubleSignedArea(vertices, count)) / 2;
+}
+
+double PolygonView::perimeter() const
+{
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        sum += (vertices[(i + 1 == count) ? 0 : i + 1] - vertices[i]).lenght();
+    }
+    return sum;
+}
+
+Rect PolygonView::bounds() const
+{
+    if (count == 0)
+    {
+        return Rect();
+    }
+
+    Vector2 minCorner = vertices[0];
+    Vector2 maxCorner = vertices[0];
+    for (std::size_t i = 1; i < count; i++)
+    {
+        minCorner.x = std::min(minCorner.x, vertices[i].x);
+        minCorner.y = std::min(minCorner.y, vertices[i].y);
+        maxCorner.x = std::max(maxCorner.x, vertices[i].x);
+        maxCorner.y = std::max(maxCorner.y, vertices[i].y);
+    }
+    return Rect(minCorner.x, minCorner.y, maxCorner.x - minCorner.x, maxCorner.y - minCorner.y);
+}
+
+Polygon PolygonView::toPolygon() const
+{
+    if (count < 3)
+    {
+        throw std::runtime_error("A polygon needs at least 3 vertices!");
+    }
+
+    Polygon polygon(vertices[0], vertices[1], vertices[2]);
+    for (std::size_t i = 3; i < count; i++)
+    {
+        polygon.addVertex(vertices[i]);
+    }
+    return polygon;
+}
+
+const Vector2* PolygonView::data() const
+{
+    return vertices;
+}
+
+std::size_t PolygonView::size() const
+{
+    return count;
+}
+
+const Vector2* PolygonView::begin() const
+{
+    return vertices;
+}
+
+const Vector2* PolygonView::end() const
+{
+    return vertices + count;
+}
+
+const Vector2& PolygonView::operator [](std::size_t index) const
+{
+    return vertices[index];
+}
+
+RectView::RectView(const Vector2* corners)
+    : corners(corners)
+{
+
+}
+
+double RectView::area() const
+{
+    return static_cast<double>(getWidth()) * getHeight();
+}
+
+double RectView::perimeter() const
+{
+    return 2.0 * (static_cast<double>(getWidth()) + getHeight());
+}
+
+Rect RectView::toRect() const
+{
+    return Rect(corners[0].x, corners[0].y, corners[1].x, corners[1].y);
+}
+
+Vector2 RectView::getPosition() const
+{
+    return corners[0];
+}
+
+float RectView::getWidth() const
+{
+    return corners[1].x;
+}
+
+float RectView::getHeight() const
+{
+    return corners[1].y;
+}
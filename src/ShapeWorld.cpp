@@ -0,0 +1,22 @@
+/**
+ * @file ShapeWorld.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::ShapeWorld class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ShapeWorld.hpp"
+
+using namespace geometry;
+
+std::size_t ShapeWorld::size() const
+{
+    return std::apply([](const auto&... pool) { return (std::size_t(0) + ... + pool.size()); }, pools);
+}
+
+void ShapeWorld::reset()
+{
+    std::apply([](auto&... pool) { (..., pool.reset()); }, pools);
+}
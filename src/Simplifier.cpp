@@ -0,0 +1,342 @@
+/**
+ * @file Simplifier.cpp
+ *
+ * @brief Implementation of the methods from the @c geometry::Simplifier and @c geometry::StreamingSimplifier classes
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace geometry;
+
+namespace {
+    /**
+     * The squared distance from a point to the segment between @p start and @p end.
+     */
+    double segmentDistanceSquared(const Vector2& start, const Vector2& end, const Vector2& point)
+    {
+        const double dx = static_cast<double>(end.x) - start.x;
+        const double dy = static_cast<double>(end.y) - start.y;
+        double px = static_cast<double>(point.x) - start.x;
+        double py = static_cast<double>(point.y) - start.y;
+
+        const double lenghtSquared = dx * dx + dy * dy;
+        if (lenghtSquared > 0.0)
+        {
+            const double t = std::clamp((px * dx + py * dy) / lenghtSquared, 0.0, 1.0);
+            px -= t * dx;
+            py -= t * dy;
+        }
+        return px * px + py * py;
+    }
+
+    double triangleArea(const Vector2& first, const Vector2& second, const Vector2& third)
+    {
+        return std::fabs((static_cast<double>(second.x) - first.x) * (static_cast<double>(third.y) - first.y)
+            - (static_cast<double>(second.y) - first.y) * (static_cast<double>(third.x) - first.x)) / 2.0;
+    }
+}
+
+std::size_t Simplifier::douglasPeucker(const Vector2* points, std::size_t count, float tolerance, std::vector<Vector2>& output)
+{
+    if (tolerance < 0.0f)
+    {
+        throw std::invalid_argument("The tolerance of a simplification can not be negative!");
+    }
+
+    output.clear();
+    if (count <= 2)
+    {
+        output.assign(points, points + count);
+        return output.size();
+    }
+
+    kept.assign(count, 0);
+    markDouglasPeucker(points, count, 0, count - 1, static_cast<double>(tolerance) * tolerance);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (kept[i])
+        {
+            output.push_back(points[i]);
+        }
+    }
+    return output.size();
+}
+
+std::size_t Simplifier::douglasPeucker(const Vector2* points, std::size_t count, float tolerance, std::vector<std::size_t>& indices)
+{
+    if (tolerance < 0.0f)
+    {
+        throw std::invalid_argument("The tolerance of a simplification can not be negative!");
+    }
+
+    indices.clear();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    kept.assign(count, 0);
+    markDouglasPeucker(points, count, 0, count - 1, static_cast<double>(tolerance) * tolerance);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (kept[i])
+        {
+            indices.push_back(i);
+        }
+    }
+    return indices.size();
+}
+
+std::size_t Simplifier::douglasPeucker(const Polygon& polygon, float tolerance, std::vector<Vector2>& output)
+{
+    if (tolerance < 0.0f)
+    {
+        throw std::invalid_argument("The tolerance of a simplification can not be negative!");
+    }
+
+    const Vector2* points = polygon.getVertices().data();
+    const std::size_t count = polygon.getVertices().size();
+
+    std::size_t farthest = 0;
+    double farthestDistance = -1.0;
+    for (std::size_t i = 1; i < count; i++)
+    {
+        const double distance = segmentDistanceSquared(points[0], points[0], points[i]);
+        if (distance > farthestDistance)
+        {
+            farthest = i;
+            farthestDistance = distance;
+        }
+    }
+
+    const double toleranceSquared = static_cast<double>(tolerance) * tolerance;
+    kept.assign(count + 1, 0);
+    markDouglasPeucker(points, count, 0, farthest, toleranceSquared);
+    markDouglasPeucker(points, count, farthest, count, toleranceSquared);
+
+    output.clear();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (kept[i])
+        {
+            output.push_back(points[i]);
+        }
+    }
+    return output.size();
+}
+
+std::size_t Simplifier::visvalingam(const Vector2* points, std::size_t count, float minArea, std::vector<Vector2>& output)
+{
+    return runVisvalingam(points, count, false, minArea, output);
+}
+
+std::size_t Simplifier::visvalingam(const Polygon& polygon, float minArea, std::vector<Vector2>& output)
+{
+    return runVisvalingam(polygon.getVertices().data(), polygon.getVertices().size(), true, minArea, output);
+}
+
+void Simplifier::markDouglasPeucker(const Vector2* points, std::size_t count, std::size_t first, std::size_t last, double toleranceSquared)
+{
+    auto pointAt = [points, count](std::size_t index) -> const Vector2& {
+        return points[index == count ? 0 : index];
+    };
+
+    kept[first] = 1;
+    kept[last] = 1;
+
+    // The ranges left to split, an explicit stack instead of recursion keeps long traces off the call stack
+    ranges.clear();
+    ranges.push_back({first, last});
+    while (!ranges.empty())
+    {
+        const Range range = ranges.back();
+        ranges.pop_back();
+
+        const Vector2& start = pointAt(range.first);
+        const Vector2& end = pointAt(range.last);
+        std::size_t farthest = range.first;
+        double farthestDistance = toleranceSquared;
+        for (std::size_t i = range.first + 1; i < range.last; i++)
+        {
+            const double distance = segmentDistanceSquared(start, end, pointAt(i));
+            if (distance > farthestDistance)
+            {
+                farthest = i;
+                farthestDistance = distance;
+            }
+        }
+
+        if (farthest != range.first)
+        {
+            kept[farthest] = 1;
+            ranges.push_back({range.first, farthest});
+            ranges.push_back({farthest, range.last});
+        }
+    }
+}
+
+std::size_t Simplifier::runVisvalingam(const Vector2* points, std::size_t count, bool closed, float minArea, std::vector<Vector2>& output)
+{
+    if (minArea < 0.0f)
+    {
+        throw std::invalid_argument("The area of a simplification can not be negative!");
+    }
+
+    output.clear();
+    const std::size_t minimumCount = closed ? 3 : 2;
+    if (count <= minimumCount)
+    {
+        output.assign(points, points + count);
+        return output.size();
+    }
+
+    previous.resize(count);
+    next.resize(count);
+    versions.assign(count, 0);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        previous[i] = (i == 0) ? count - 1 : i - 1;
+        next[i] = (i + 1 == count) ? 0 : i + 1;
+    }
+
+    // A min-heap on area, entries whose version is stale belong to points already removed or updated
+    auto later = [](const HeapEntry& first, const HeapEntry& second) {
+        return first.area > second.area;
+    };
+    auto pushPoint = [&](std::size_t point, double floor) {
+        const double area = std::max(triangleArea(points[previous[point]], points[point], points[next[point]]), floor);
+        heap.push_back({area, point, ++versions[point]});
+        std::push_heap(heap.begin(), heap.end(), later);
+    };
+
+    heap.clear();
+    const std::size_t first = closed ? 0 : 1;
+    const std::size_t last = closed ? count : count - 1;
+    for (std::size_t i = first; i < last; i++)
+    {
+        pushPoint(i, 0.0);
+    }
+
+    std::size_t remaining = count;
+    while (!heap.empty() && remaining > minimumCount)
+    {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        const HeapEntry entry = heap.back();
+        heap.pop_back();
+        if (entry.version != versions[entry.point])
+        {
+            continue;
+        }
+        if (entry.area >= minArea)
+        {
+            break;
+        }
+
+        // Removing the point changes the triangles of both neighbours, which may not get smaller than
+        // the one removed, so points are always dropped in order of area
+        const std::size_t before = previous[entry.point];
+        const std::size_t after = next[entry.point];
+        next[before] = after;
+        previous[after] = before;
+        versions[entry.point] = 0;
+        remaining--;
+
+        if (closed || before != 0)
+        {
+            pushPoint(before, entry.area);
+        }
+        if (closed || after != count - 1)
+        {
+            pushPoint(after, entry.area);
+        }
+    }
+
+    std::size_t point = 0;
+    if (closed)
+    {
+        // The first point may be gone, any survivor starts the walk
+        while (versions[point] == 0)
+        {
+            point++;
+        }
+    }
+    for (std::size_t i = 0; i < remaining; i++)
+    {
+        output.push_back(points[point]);
+        point = next[point];
+    }
+    return output.size();
+}
+
+StreamingSimplifier::StreamingSimplifier(float tolerance, std::size_t windowSize)
+    : tolerance(tolerance), windowSize(windowSize)
+{
+    if (tolerance < 0.0f)
+    {
+        throw std::invalid_argument("The tolerance of a simplification can not be negative!");
+    }
+    if (windowSize < 3)
+    {
+        throw std::invalid_argument("The window of a StreamingSimplifier must hold at least 3 points!");
+    }
+    pending.reserve(windowSize);
+}
+
+void StreamingSimplifier::push(const Vector2* points, std::size_t count, std::vector<Vector2>& output)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (pending.empty())
+        {
+            // The first point of a polyline is always kept
+            output.push_back(points[i]);
+        }
+
+        pending.push_back(points[i]);
+        if (pending.size() == windowSize)
+        {
+            flushWindow(output);
+        }
+    }
+}
+
+void StreamingSimplifier::finish(std::vector<Vector2>& output)
+{
+    if (pending.size() > 1)
+    {
+        simplifier.douglasPeucker(pending.data(), pending.size(), tolerance, keptIndices);
+        for (std::size_t i = 1; i < keptIndices.size(); i++)
+        {
+            output.push_back(pending[keptIndices[i]]);
+        }
+    }
+    pending.clear();
+}
+
+std::size_t StreamingSimplifier::getPendingCount() const
+{
+    return pending.size();
+}
+
+void StreamingSimplifier::flushWindow(std::vector<Vector2>& output)
+{
+    simplifier.douglasPeucker(pending.data(), pending.size(), tolerance, keptIndices);
+
+    // The last segment may still grow with the next points, so its start becomes the new anchor.
+    // When the whole window is a single segment, the segment is final and its end is the anchor.
+    const std::size_t emitted = std::max<std::size_t>(keptIndices.size() - 1, 2);
+    for (std::size_t i = 1; i < emitted; i++)
+    {
+        output.push_back(pending[keptIndices[i]]);
+    }
+    pending.erase(pending.begin(), pending.begin() + keptIndices[emitted - 1]);
+}
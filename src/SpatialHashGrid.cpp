@@ -0,0 +1,294 @@
+/**
+ * @file SpatialHashGrid.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::SpatialHashGrid class
+ * 
+ * Every object is stored once in each bucket its cells hash to. A pair (or a query hit) is only
+ * reported from the bucket of the cell that contains the minimum corner of the overlap, which
+ * both objects are guaranteed to share, so no "already reported" bookkeeping is needed.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace geometry;
+
+SpatialHashGrid::SpatialHashGrid(float cellSize, std::size_t bucketCount)
+    : cellSize(1.0f), inverseCellSize(1.0f), bucketMask(0)
+{
+    std::size_t roundedCount = 1;
+    while (roundedCount < bucketCount)
+    {
+        roundedCount <<= 1;
+    }
+    buckets.resize(roundedCount);
+    bucketMask = roundedCount - 1;
+
+    setCellSize(cellSize);
+}
+
+std::size_t SpatialHashGrid::findPairs(std::vector<IndexPair>& pairs) const
+{
+    pairs.clear();
+
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        const auto& members = buckets[bucket];
+        for (std::size_t i = 0; i < members.size(); i++)
+        {
+            const Proxy& first = proxies[members[i]];
+            for (std::size_t j = i + 1; j < members.size(); j++)
+            {
+                const Proxy& second = proxies[members[j]];
+                if (first.minX > second.maxX || second.minX > first.maxX || first.minY > second.maxY || second.minY > first.maxY)
+                {
+                    continue;
+                }
+
+                std::int32_t cellX = cellCoordinate(std::max(first.minX, second.minX));
+                std::int32_t cellY = cellCoordinate(std::max(first.minY, second.minY));
+                if (bucketOf(cellX, cellY) != bucket)
+                {
+                    continue;
+                }
+
+                pairs.push_back({std::min(first.userData, second.userData), std::max(first.userData, second.userData)});
+            }
+        }
+    }
+
+    return pairs.size();
+}
+
+std::size_t SpatialHashGrid::query(const Rect& region, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    const Vector2 position = region.getPosition();
+    const float minX = position.x, minY = position.y;
+    const float maxX = minX + region.getWidth(), maxY = minY + region.getHeight();
+
+    collectBuckets(cellRangeOf(minX, minY, maxX, maxY), scratchQueryBuckets);
+    for (std::size_t bucket : scratchQueryBuckets)
+    {
+        for (ProxyId id : buckets[bucket])
+        {
+            const Proxy& proxy = proxies[id];
+            if (proxy.minX > maxX || minX > proxy.maxX || proxy.minY > maxY || minY > proxy.maxY)
+            {
+                continue;
+            }
+            if (bucketOf(cellCoordinate(std::max(minX, proxy.minX)), cellCoordinate(std::max(minY, proxy.minY))) == bucket)
+            {
+                hits.push_back(proxy.userData);
+            }
+        }
+    }
+
+    return hits.size();
+}
+
+std::size_t SpatialHashGrid::size() const
+{
+    return aliveCount;
+}
+
+float SpatialHashGrid::getCellSize() const
+{
+    return cellSize;
+}
+
+std::uint32_t SpatialHashGrid::getUserData(ProxyId proxy) const
+{
+    return proxies[proxy].userData;
+}
+
+Rect SpatialHashGrid::getBounds(ProxyId proxy) const
+{
+    const Proxy& p = proxies[proxy];
+    return Rect(p.minX, p.minY, p.maxX - p.minX, p.maxY - p.minY);
+}
+
+SpatialHashGrid::ProxyId SpatialHashGrid::insert(const Rect& bounds, std::uint32_t userData)
+{
+    ProxyId id;
+    if (!freeProxies.empty())
+    {
+        id = freeProxies.back();
+        freeProxies.pop_back();
+    }
+    else
+    {
+        id = static_cast<ProxyId>(proxies.size());
+        proxies.emplace_back();
+    }
+
+    const Vector2 position = bounds.getPosition();
+    Proxy& proxy = proxies[id];
+    proxy.minX = position.x;
+    proxy.minY = position.y;
+    proxy.maxX = position.x + bounds.getWidth();
+    proxy.maxY = position.y + bounds.getHeight();
+    proxy.cells = cellRangeOf(proxy.minX, proxy.minY, proxy.maxX, proxy.maxY);
+    proxy.userData = userData;
+    proxy.alive = true;
+
+    addToBuckets(id);
+    aliveCount++;
+    return id;
+}
+
+SpatialHashGrid::ProxyId SpatialHashGrid::insert(const Shape& shape, std::uint32_t userData)
+{
+    return insert(shape.bounds(), userData);
+}
+
+void SpatialHashGrid::remove(ProxyId proxy)
+{
+    if (proxy >= proxies.size() || !proxies[proxy].alive)
+    {
+        throw std::invalid_argument("The proxy is not part of the grid!");
+    }
+
+    removeFromBuckets(proxy);
+    proxies[proxy].alive = false;
+    freeProxies.push_back(proxy);
+    aliveCount--;
+}
+
+void SpatialHashGrid::update(ProxyId proxy, const Rect& bounds)
+{
+    if (proxy >= proxies.size() || !proxies[proxy].alive)
+    {
+        throw std::invalid_argument("The proxy is not part of the grid!");
+    }
+
+    Proxy& p = proxies[proxy];
+    const Vector2 position = bounds.getPosition();
+    p.minX = position.x;
+    p.minY = position.y;
+    p.maxX = position.x + bounds.getWidth();
+    p.maxY = position.y + bounds.getHeight();
+
+    CellRange cells = cellRangeOf(p.minX, p.minY, p.maxX, p.maxY);
+    if (cells == p.cells)
+    {
+        return;
+    }
+
+    removeFromBuckets(proxy);
+    p.cells = cells;
+    addToBuckets(proxy);
+}
+
+void SpatialHashGrid::setCellSize(float cellSize)
+{
+    if (!(cellSize > 0.0f))
+    {
+        throw std::invalid_argument("The cell size of a SpatialHashGrid must be positive!");
+    }
+
+    this->cellSize = cellSize;
+    this->inverseCellSize = 1.0f / cellSize;
+
+    for (auto& bucket : buckets)
+    {
+        bucket.clear();
+    }
+    for (ProxyId id = 0; id < proxies.size(); id++)
+    {
+        Proxy& proxy = proxies[id];
+        if (proxy.alive)
+        {
+            proxy.cells = cellRangeOf(proxy.minX, proxy.minY, proxy.maxX, proxy.maxY);
+            addToBuckets(id);
+        }
+    }
+}
+
+void SpatialHashGrid::clear()
+{
+    for (auto& bucket : buckets)
+    {
+        bucket.clear();
+    }
+    proxies.clear();
+    freeProxies.clear();
+    aliveCount = 0;
+}
+
+std::int32_t SpatialHashGrid::cellCoordinate(float coordinate) const
+{
+    return static_cast<std::int32_t>(std::floor(coordinate * inverseCellSize));
+}
+
+std::size_t SpatialHashGrid::bucketOf(std::int32_t cellX, std::int32_t cellY) const
+{
+    std::uint32_t hash = (static_cast<std::uint32_t>(cellX) * 73856093u) ^ (static_cast<std::uint32_t>(cellY) * 19349663u);
+    return hash & bucketMask;
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::cellRangeOf(float minX, float minY, float maxX, float maxY) const
+{
+    return { cellCoordinate(minX), cellCoordinate(minY), cellCoordinate(maxX), cellCoordinate(maxY) };
+}
+
+void SpatialHashGrid::collectBuckets(const CellRange& cells, std::vector<std::size_t>& out) const
+{
+    out.clear();
+
+    const std::uint64_t columns = static_cast<std::uint64_t>(static_cast<std::int64_t>(cells.maxX) - cells.minX + 1);
+    const std::uint64_t rows = static_cast<std::uint64_t>(static_cast<std::int64_t>(cells.maxY) - cells.minY + 1);
+
+    // An object covering more cells than there are buckets lands in every bucket anyway.
+    if (columns * rows >= buckets.size())
+    {
+        for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+        {
+            out.push_back(bucket);
+        }
+        return;
+    }
+
+    for (std::int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+    {
+        for (std::int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+        {
+            out.push_back(bucketOf(cellX, cellY));
+        }
+    }
+
+    // Different cells may hash to the same bucket, an object is stored only once per bucket.
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+void SpatialHashGrid::addToBuckets(ProxyId proxy)
+{
+    collectBuckets(proxies[proxy].cells, scratchBuckets);
+    for (std::size_t bucket : scratchBuckets)
+    {
+        buckets[bucket].push_back(proxy);
+    }
+}
+
+void SpatialHashGrid::removeFromBuckets(ProxyId proxy)
+{
+    collectBuckets(proxies[proxy].cells, scratchBuckets);
+    for (std::size_t bucket : scratchBuckets)
+    {
+        auto& members = buckets[bucket];
+        auto position = std::find(members.begin(), members.end(), proxy);
+        if (position != members.end())
+        {
+            *position = members.back();
+            members.pop_back();
+        }
+    }
+}
@@ -0,0 +1,441 @@
+/**
+ * @file SweepAndPrune.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::SweepAndPrune class
+ * 
+ * When an endpoint is sifted past an endpoint of another object, the intervals of the two objects
+ * on that axis either start overlapping (a min crossing a max towards it) or stop overlapping
+ * (a min and a max separating). Starting is confirmed with a full box test, stopping always
+ * drops the pair.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    std::uint64_t pairKey(std::uint32_t first, std::uint32_t second)
+    {
+        if (first > second)
+        {
+            std::swap(first, second);
+        }
+        return (static_cast<std::uint64_t>(first) << 32) | second;
+    }
+
+    IndexPair pairFromKey(std::uint64_t key)
+    {
+        return { static_cast<std::uint32_t>(key >> 32), static_cast<std::uint32_t>(key & 0xFFFFFFFFu) };
+    }
+
+    void sortPairs(std::vector<IndexPair>& pairs)
+    {
+        std::sort(pairs.begin(), pairs.end(), [](const IndexPair& a, const IndexPair& b) {
+            return (a.first != b.first) ? a.first < b.first : a.second < b.second;
+        });
+    }
+
+    float lowerOf(const Box& box, int axis)
+    {
+        return (axis == 0) ? box.minX : box.minY;
+    }
+
+    float upperOf(const Box& box, int axis)
+    {
+        return (axis == 0) ? box.maxX : box.maxY;
+    }
+
+    /**
+     * The order of the endpoints, on equal values the mins come first so touching intervals count as overlapping.
+     */
+    template <typename Endpoint>
+    bool comesBefore(const Endpoint& first, const Endpoint& second)
+    {
+        return first.value < second.value || (first.value == second.value && first.isMin && !second.isMin);
+    }
+}
+
+std::size_t SweepAndPrune::findPairs(std::vector<IndexPair>& out) const
+{
+    out.clear();
+    for (std::uint64_t key : pairs)
+    {
+        IndexPair proxyPair = pairFromKey(key);
+        out.push_back(pairFromKey(pairKey(proxies[proxyPair.first].userData, proxies[proxyPair.second].userData)));
+    }
+    sortPairs(out);
+    return out.size();
+}
+
+std::size_t SweepAndPrune::size() const
+{
+    return aliveCount;
+}
+
+std::uint32_t SweepAndPrune::getUserData(ProxyId proxy) const
+{
+    return proxies[proxy].userData;
+}
+
+SweepAndPrune::ProxyId SweepAndPrune::insert(const Rect& bounds, std::uint32_t userData)
+{
+    ProxyId id;
+    if (!freeProxies.empty())
+    {
+        id = freeProxies.back();
+        freeProxies.pop_back();
+    }
+    else
+    {
+        id = static_cast<ProxyId>(proxies.size());
+        proxies.emplace_back();
+    }
+
+    // The endpoints are merged into the axes by the next updatePairs().
+    Proxy& proxy = proxies[id];
+    proxy.box = Box::fromRect(bounds);
+    proxy.pending = proxy.box;
+    proxy.userData = userData;
+    proxy.alive = true;
+    proxy.moved = false;
+    proxy.fresh = true;
+    insertedProxies.push_back(id);
+
+    aliveCount++;
+    return id;
+}
+
+SweepAndPrune::ProxyId SweepAndPrune::insert(const Shape& shape, std::uint32_t userData)
+{
+    return insert(shape.bounds(), userData);
+}
+
+void SweepAndPrune::remove(ProxyId id)
+{
+    if (id >= proxies.size() || !proxies[id].alive)
+    {
+        throw std::invalid_argument("The proxy is not part of the broadphase!");
+    }
+
+    proxies[id].alive = false;
+    removedProxies.push_back(id);
+    aliveCount--;
+}
+
+void SweepAndPrune::update(ProxyId id, const Rect& bounds)
+{
+    if (id >= proxies.size() || !proxies[id].alive)
+    {
+        throw std::invalid_argument("The proxy is not part of the broadphase!");
+    }
+
+    Proxy& proxy = proxies[id];
+    proxy.pending = Box::fromRect(bounds);
+
+    if (!proxy.moved)
+    {
+        proxy.moved = true;
+        movedProxies.push_back(id);
+    }
+}
+
+void SweepAndPrune::updatePairs(std::vector<IndexPair>& added, std::vector<IndexPair>& removed)
+{
+    removeDeadProxies();
+
+    for (ProxyId id : movedProxies)
+    {
+        Proxy& proxy = proxies[id];
+        if (!proxy.moved)
+        {
+            continue;
+        }
+        proxy.moved = false;
+        if (proxy.alive && !proxy.fresh)
+        {
+            applyBounds(id, proxy.pending);
+        }
+    }
+    movedProxies.clear();
+
+    insertNewProxies();
+
+    added.clear();
+    removed.clear();
+    for (std::uint64_t key : pendingAdded)
+    {
+        added.push_back(pairFromKey(key));
+    }
+    for (std::uint64_t key : pendingRemoved)
+    {
+        removed.push_back(pairFromKey(key));
+    }
+    sortPairs(added);
+    sortPairs(removed);
+
+    pendingAdded.clear();
+    pendingRemoved.clear();
+}
+
+void SweepAndPrune::removeDeadProxies()
+{
+    if (removedProxies.empty())
+    {
+        return;
+    }
+
+    for (auto pair = pairs.begin(); pair != pairs.end();)
+    {
+        const IndexPair proxyPair = pairFromKey(*pair);
+        if (proxies[proxyPair.first].alive && proxies[proxyPair.second].alive)
+        {
+            ++pair;
+            continue;
+        }
+
+        std::uint64_t userKey = pairKey(proxies[proxyPair.first].userData, proxies[proxyPair.second].userData);
+        if (pendingAdded.erase(userKey) == 0)
+        {
+            pendingRemoved.insert(userKey);
+        }
+        pair = pairs.erase(pair);
+    }
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        auto& endpoints = axes[axis];
+        endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [this](const Endpoint& endpoint) {
+            return !proxies[endpoint.proxy].alive;
+        }), endpoints.end());
+        renumber(axis);
+    }
+
+    // An object added and removed before this call never had endpoints, its id is freed all the same
+    for (ProxyId id : removedProxies)
+    {
+        proxies[id].fresh = false;
+        freeProxies.push_back(id);
+    }
+    removedProxies.clear();
+}
+
+void SweepAndPrune::insertNewProxies()
+{
+    if (insertedProxies.empty())
+    {
+        return;
+    }
+
+    for (ProxyId id : insertedProxies)
+    {
+        if (proxies[id].alive)
+        {
+            proxies[id].box = proxies[id].pending;
+        }
+    }
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        newEndpoints.clear();
+        for (ProxyId id : insertedProxies)
+        {
+            const Proxy& proxy = proxies[id];
+            if (proxy.alive)
+            {
+                newEndpoints.push_back({lowerOf(proxy.box, axis), id, true});
+                newEndpoints.push_back({upperOf(proxy.box, axis), id, false});
+            }
+        }
+        std::sort(newEndpoints.begin(), newEndpoints.end(), comesBefore<Endpoint>);
+
+        mergedEndpoints.clear();
+        std::merge(axes[axis].begin(), axes[axis].end(), newEndpoints.begin(), newEndpoints.end(),
+            std::back_inserter(mergedEndpoints), comesBefore<Endpoint>);
+        axes[axis].swap(mergedEndpoints);
+        renumber(axis);
+    }
+
+    // One sweep on X finds the pairs of the new objects, with each other and with the old ones. The
+    // intervals open at an endpoint are kept in two lists, so old objects are never tested together.
+    activeOld.clear();
+    activeNew.clear();
+    activeSlots.resize(proxies.size());
+    for (const Endpoint& endpoint : axes[0])
+    {
+        const Proxy& proxy = proxies[endpoint.proxy];
+        std::vector<ProxyId>& active = proxy.fresh ? activeNew : activeOld;
+
+        if (!endpoint.isMin)
+        {
+            const std::uint32_t slot = activeSlots[endpoint.proxy];
+            active[slot] = active.back();
+            activeSlots[active[slot]] = slot;
+            active.pop_back();
+            continue;
+        }
+
+        for (ProxyId other : activeNew)
+        {
+            if (proxy.box.overlaps(proxies[other].box))
+            {
+                addPair(endpoint.proxy, other);
+            }
+        }
+        if (proxy.fresh)
+        {
+            for (ProxyId other : activeOld)
+            {
+                if (proxy.box.overlaps(proxies[other].box))
+                {
+                    addPair(endpoint.proxy, other);
+                }
+            }
+        }
+
+        activeSlots[endpoint.proxy] = static_cast<std::uint32_t>(active.size());
+        active.push_back(endpoint.proxy);
+    }
+
+    for (ProxyId id : insertedProxies)
+    {
+        proxies[id].fresh = false;
+    }
+    insertedProxies.clear();
+}
+
+void SweepAndPrune::renumber(int axis)
+{
+    const auto& endpoints = axes[axis];
+    for (std::uint32_t index = 0; index < endpoints.size(); index++)
+    {
+        Proxy& owner = proxies[endpoints[index].proxy];
+        (endpoints[index].isMin ? owner.minIndex[axis] : owner.maxIndex[axis]) = index;
+    }
+}
+
+void SweepAndPrune::applyBounds(ProxyId id, const Box& box)
+{
+    const Box old = proxies[id].box;
+    proxies[id].box = box;
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        const float oldMin = lowerOf(old, axis), oldMax = upperOf(old, axis);
+        const float newMin = lowerOf(box, axis), newMax = upperOf(box, axis);
+
+        axes[axis][proxies[id].minIndex[axis]].value = newMin;
+        axes[axis][proxies[id].maxIndex[axis]].value = newMax;
+
+        // Growing first, then shrinking, so the min never has to cross its own max.
+        if (newMin < oldMin)
+        {
+            siftDown(axis, proxies[id].minIndex[axis]);
+        }
+        if (newMax > oldMax)
+        {
+            siftUp(axis, proxies[id].maxIndex[axis]);
+        }
+        if (newMin > oldMin)
+        {
+            siftUp(axis, proxies[id].minIndex[axis]);
+        }
+        if (newMax < oldMax)
+        {
+            siftDown(axis, proxies[id].maxIndex[axis]);
+        }
+    }
+}
+
+void SweepAndPrune::siftDown(int axis, std::uint32_t index)
+{
+    auto& endpoints = axes[axis];
+    while (index > 0 && comesBefore(endpoints[index], endpoints[index - 1]))
+    {
+        onCrossing(endpoints[index], endpoints[index - 1], false);
+        swapEndpoints(axis, index, index - 1);
+        index--;
+    }
+}
+
+void SweepAndPrune::siftUp(int axis, std::uint32_t index)
+{
+    auto& endpoints = axes[axis];
+    while (index + 1 < endpoints.size() && comesBefore(endpoints[index + 1], endpoints[index]))
+    {
+        onCrossing(endpoints[index], endpoints[index + 1], true);
+        swapEndpoints(axis, index, index + 1);
+        index++;
+    }
+}
+
+void SweepAndPrune::swapEndpoints(int axis, std::uint32_t first, std::uint32_t second)
+{
+    auto& endpoints = axes[axis];
+    std::swap(endpoints[first], endpoints[second]);
+
+    for (std::uint32_t index : { first, second })
+    {
+        Proxy& owner = proxies[endpoints[index].proxy];
+        (endpoints[index].isMin ? owner.minIndex[axis] : owner.maxIndex[axis]) = index;
+    }
+}
+
+void SweepAndPrune::onCrossing(const Endpoint& moving, const Endpoint& crossed, bool movingUp)
+{
+    if (moving.proxy == crossed.proxy || moving.isMin == crossed.isMin)
+    {
+        return;
+    }
+
+    // A min moving down past a max, or a max moving up past a min, brings the intervals together.
+    const bool starts = (moving.isMin != movingUp);
+    if (starts)
+    {
+        const Proxy& first = proxies[moving.proxy];
+        const Proxy& second = proxies[crossed.proxy];
+        if (first.alive && second.alive && first.box.overlaps(second.box))
+        {
+            addPair(moving.proxy, crossed.proxy);
+        }
+    }
+    else
+    {
+        removePair(moving.proxy, crossed.proxy);
+    }
+}
+
+void SweepAndPrune::addPair(ProxyId first, ProxyId second)
+{
+    if (!pairs.insert(pairKey(first, second)).second)
+    {
+        return;
+    }
+
+    std::uint64_t userKey = pairKey(proxies[first].userData, proxies[second].userData);
+    if (pendingRemoved.erase(userKey) == 0)
+    {
+        pendingAdded.insert(userKey);
+    }
+}
+
+void SweepAndPrune::removePair(ProxyId first, ProxyId second)
+{
+    if (pairs.erase(pairKey(first, second)) == 0)
+    {
+        return;
+    }
+
+    std::uint64_t userKey = pairKey(proxies[first].userData, proxies[second].userData);
+    if (pendingAdded.erase(userKey) == 0)
+    {
+        pendingRemoved.insert(userKey);
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file ThreadPool.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::ThreadPool class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/ThreadPool.hpp"
+
+using namespace geometry;
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : queuedTasks(0), stopping(false), nextQueue(0)
+{
+    // The calling thread counts as one of the threads and gets the last queue.
+    const std::size_t workerCount = std::max<std::size_t>(threadCount, 1) - 1;
+
+    for (std::size_t i = 0; i <= workerCount; i++)
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; i++)
+    {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::getThreadCount() const
+{
+    return workers.size() + 1;
+}
+
+void ThreadPool::push(Task task)
+{
+    Queue& queue = *queues[nextQueue];
+    nextQueue = (nextQueue + 1) % queues.size();
+
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks++;
+    }
+    wakeUp.notify_one();
+}
+
+bool ThreadPool::runOne(std::size_t slot)
+{
+    Task task;
+
+    for (std::size_t offset = 0; offset < queues.size() && !task; offset++)
+    {
+        Queue& queue = *queues[(slot + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+        {
+            continue;
+        }
+
+        // The own queue is used as a stack, which keeps recently pushed work hot in the cache,
+        // while thieves take the oldest task from the other end.
+        if (offset == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks--;
+    }
+    task(slot);
+    return true;
+}
+
+void ThreadPool::workerLoop(std::size_t slot)
+{
+    while (true)
+    {
+        if (runOne(slot))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this]() { return stopping || queuedTasks > 0; });
+        if (stopping && queuedTasks == 0)
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file Triangle.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::Triangle class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Triangle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+using namespace geometry;
+
+namespace {
+    void projectOnAxis(const std::array<Vector2, 3>& vertices, const Vector2& axis, float& min, float& max)
+    {
+        const float p0 = axis.dot(vertices[0]), p1 = axis.dot(vertices[1]), p2 = axis.dot(vertices[2]);
+
+        min = std::min({p0, p1, p2});
+        max = std::max({p0, p1, p2});
+    }
+}
+
+Triangle::Triangle(Vector2 firstVertex, Vector2 secondVertex, Vector2 thirdVertex)
+    : vertices{firstVertex, secondVertex, thirdVertex}
+{
+
+}
+
+double Triangle::area() const
+{
+    const Vector2 firstEdge = vertices[1] - vertices[0];
+    const Vector2 secondEdge = vertices[2] - vertices[0];
+
+    return std::fabs(static_cast<double>(firstEdge.x) * secondEdge.y - static_cast<double>(firstEdge.y) * secondEdge.x) / 2;
+}
+
+double Triangle::perimeter() const
+{
+    return (vertices[1] - vertices[0]).lenght() + (vertices[2] - vertices[1]).lenght() + (vertices[0] - vertices[2]).lenght();
+}
+
+Vector2 Triangle::center() const
+{
+    return (vertices[0] + vertices[1] + vertices[2]) / 3.0f;
+}
+
+Rect Triangle::bounds() const
+{
+    const float minX = std::min({vertices[0].x, vertices[1].x, vertices[2].x});
+    const float minY = std::min({vertices[0].y, vertices[1].y, vertices[2].y});
+    const float maxX = std::max({vertices[0].x, vertices[1].x, vertices[2].x});
+    const float maxY = std::max({vertices[0].y, vertices[1].y, vertices[2].y});
+
+    return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+Vector2 Triangle::support(const Vector2& direction) const
+{
+    const Vector2* farthest = &vertices[0];
+    float farthestProjection = direction.dot(vertices[0]);
+
+    for (const auto& vertex : vertices)
+    {
+        const float projection = direction.dot(vertex);
+        if (projection > farthestProjection)
+        {
+            farthest = &vertex;
+            farthestProjection = projection;
+        }
+    }
+
+    return *farthest;
+}
+
+void Triangle::moveTo(const Vector2& newPos)
+{
+    moveWith(newPos - center());
+}
+
+void Triangle::moveWith(const Vector2& changePos)
+{
+    for (auto& vertex : vertices)
+    {
+        vertex += changePos;
+    }
+}
+
+Barycentric Triangle::barycentric(const Vector2& point) const
+{
+    const Vector2 firstEdge = vertices[1] - vertices[0];
+    const Vector2 secondEdge = vertices[2] - vertices[0];
+    const Vector2 offset = point - vertices[0];
+
+    const float denominator = firstEdge.x * secondEdge.y - firstEdge.y * secondEdge.x;
+    const float v = (offset.x * secondEdge.y - offset.y * secondEdge.x) / denominator;
+    const float w = (firstEdge.x * offset.y - firstEdge.y * offset.x) / denominator;
+
+    return {1.0f - v - w, v, w};
+}
+
+bool Triangle::contains(const Vector2& point) const
+{
+    const Barycentric coordinates = barycentric(point);
+    return coordinates.u >= 0.0f && coordinates.v >= 0.0f && coordinates.w >= 0.0f;
+}
+
+bool Triangle::overlaps(const Triangle& other) const
+{
+    // Separating axis test on the normals of the six edges, which don't need to be normalized.
+    for (const Triangle* owner : {this, &other})
+    {
+        for (std::size_t edge = 0; edge < 3; edge++)
+        {
+            const Vector2& start = owner->vertices[edge];
+            const Vector2& end = owner->vertices[(edge + 1) % 3];
+            const Vector2 axis(start.y - end.y, end.x - start.x);
+
+            float firstMin, firstMax, secondMin, secondMax;
+            projectOnAxis(vertices, axis, firstMin, firstMax);
+            projectOnAxis(other.vertices, axis, secondMin, secondMax);
+
+            if (firstMax < secondMin || secondMax < firstMin)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+const std::array<Vector2, 3>& Triangle::getVertices() const
+{
+    return vertices;
+}
@@ -0,0 +1,259 @@
+/**
+ * @file TriangleArray.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::TriangleArray class
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/TriangleArray.hpp"
+
+#include <stdexcept>
+
+#include "geometry/internal/TriangleKernels.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    TrianglePack loadTriangles(const TriangleArray& triangles, std::size_t index)
+    {
+        return {simd::load(triangles.xData(0) + index), simd::load(triangles.yData(0) + index),
+            simd::load(triangles.xData(1) + index), simd::load(triangles.yData(1) + index),
+            simd::load(triangles.xData(2) + index), simd::load(triangles.yData(2) + index)};
+    }
+
+    TrianglePack broadcastTriangle(const Triangle& triangle)
+    {
+        const auto& vertices = triangle.getVertices();
+        return {simd::broadcast(vertices[0].x), simd::broadcast(vertices[0].y),
+            simd::broadcast(vertices[1].x), simd::broadcast(vertices[1].y),
+            simd::broadcast(vertices[2].x), simd::broadcast(vertices[2].y)};
+    }
+
+    /**
+     * Stores v and w, and u = 1 - v - w, of a pack at position @p index.
+     */
+    void storeCoordinates(simd::Pack v, simd::Pack w, std::size_t index, std::vector<float>& us, std::vector<float>& vs, std::vector<float>& ws)
+    {
+        simd::storeu(&us[index], simd::broadcast(1.0f) - v - w);
+        simd::storeu(&vs[index], v);
+        simd::storeu(&ws[index], w);
+    }
+
+    void storeCoordinates(const Barycentric& coordinates, std::size_t index, std::vector<float>& us, std::vector<float>& vs, std::vector<float>& ws)
+    {
+        us[index] = coordinates.u;
+        vs[index] = coordinates.v;
+        ws[index] = coordinates.w;
+    }
+
+    void appendLanes(int mask, std::size_t index, std::vector<std::uint32_t>& hits)
+    {
+        unsigned lanes = static_cast<unsigned>(mask);
+        while (lanes != 0)
+        {
+            hits.push_back(static_cast<std::uint32_t>(index + simd::lowestSetLane(lanes)));
+            lanes &= lanes - 1;
+        }
+    }
+
+    constexpr unsigned ALL_LANES = (1u << simd::WIDTH) - 1;
+}
+
+TriangleArray::TriangleArray(const std::vector<Triangle>& triangles)
+{
+    reserve(triangles.size());
+    for (const auto& triangle : triangles)
+    {
+        push_back(triangle);
+    }
+}
+
+std::size_t TriangleArray::size() const
+{
+    return xs[0].size();
+}
+
+bool TriangleArray::empty() const
+{
+    return xs[0].empty();
+}
+
+Triangle TriangleArray::get(std::size_t index) const
+{
+    return Triangle(Vector2(xs[0][index], ys[0][index]), Vector2(xs[1][index], ys[1][index]), Vector2(xs[2][index], ys[2][index]));
+}
+
+void TriangleArray::barycentric(const Vector2Array& points, std::vector<float>& u, std::vector<float>& v, std::vector<float>& w) const
+{
+    checkSameSize(points);
+
+    const std::size_t count = size();
+    u.resize(count);
+    v.resize(count);
+    w.resize(count);
+
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack packV, packW;
+        internal::barycentric(loadTriangles(*this, i), simd::load(points.xData() + i), simd::load(points.yData() + i), packV, packW);
+        storeCoordinates(packV, packW, i, u, v, w);
+    }
+    for (; i < count; i++)
+    {
+        storeCoordinates(get(i).barycentric(points.get(i)), i, u, v, w);
+    }
+}
+
+void TriangleArray::barycentric(const Triangle& triangle, const Vector2Array& points, std::vector<float>& u, std::vector<float>& v, std::vector<float>& w)
+{
+    const std::size_t count = points.size();
+    u.resize(count);
+    v.resize(count);
+    w.resize(count);
+
+    const TrianglePack broadcasted = broadcastTriangle(triangle);
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack packV, packW;
+        internal::barycentric(broadcasted, simd::load(points.xData() + i), simd::load(points.yData() + i), packV, packW);
+        storeCoordinates(packV, packW, i, u, v, w);
+    }
+    for (; i < count; i++)
+    {
+        storeCoordinates(triangle.barycentric(points.get(i)), i, u, v, w);
+    }
+}
+
+void TriangleArray::contains(const Vector2Array& points, std::vector<std::uint8_t>& results) const
+{
+    checkSameSize(points);
+
+    const std::size_t count = size();
+    results.resize(count);
+
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+    for (; i < packed; i += simd::WIDTH)
+    {
+        const unsigned mask = static_cast<unsigned>(simd::moveMask(containsMask(loadTriangles(*this, i), simd::load(points.xData() + i), simd::load(points.yData() + i))));
+        for (std::size_t lane = 0; lane < simd::WIDTH; lane++)
+        {
+            results[i + lane] = (mask >> lane) & 1u;
+        }
+    }
+    for (; i < count; i++)
+    {
+        results[i] = get(i).contains(points.get(i)) ? 1 : 0;
+    }
+}
+
+std::size_t TriangleArray::findContaining(const Vector2& point, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    const simd::Pack x = simd::broadcast(point.x), y = simd::broadcast(point.y);
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+    for (; i < packed; i += simd::WIDTH)
+    {
+        appendLanes(simd::moveMask(containsMask(loadTriangles(*this, i), x, y)), i, hits);
+    }
+    for (; i < count; i++)
+    {
+        if (get(i).contains(point))
+        {
+            hits.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    return hits.size();
+}
+
+std::size_t TriangleArray::findOverlapping(const Triangle& triangle, std::vector<std::uint32_t>& hits) const
+{
+    hits.clear();
+
+    const TrianglePack broadcasted = broadcastTriangle(triangle);
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+    for (; i < packed; i += simd::WIDTH)
+    {
+        const unsigned separated = static_cast<unsigned>(simd::moveMask(separatedMask(loadTriangles(*this, i), broadcasted)));
+        appendLanes(static_cast<int>(~separated & ALL_LANES), i, hits);
+    }
+    for (; i < count; i++)
+    {
+        if (get(i).overlaps(triangle))
+        {
+            hits.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    return hits.size();
+}
+
+void TriangleArray::reserve(std::size_t capacity)
+{
+    for (std::size_t vertex = 0; vertex < 3; vertex++)
+    {
+        xs[vertex].reserve(capacity);
+        ys[vertex].reserve(capacity);
+    }
+}
+
+void TriangleArray::clear()
+{
+    for (std::size_t vertex = 0; vertex < 3; vertex++)
+    {
+        xs[vertex].clear();
+        ys[vertex].clear();
+    }
+}
+
+void TriangleArray::push_back(const Triangle& triangle)
+{
+    const auto& vertices = triangle.getVertices();
+    for (std::size_t vertex = 0; vertex < 3; vertex++)
+    {
+        xs[vertex].push_back(vertices[vertex].x);
+        ys[vertex].push_back(vertices[vertex].y);
+    }
+}
+
+TriangleArray& TriangleArray::set(std::size_t index, const Triangle& triangle)
+{
+    const auto& vertices = triangle.getVertices();
+    for (std::size_t vertex = 0; vertex < 3; vertex++)
+    {
+        xs[vertex][index] = vertices[vertex].x;
+        ys[vertex][index] = vertices[vertex].y;
+    }
+    return *this;
+}
+
+const float* TriangleArray::xData(std::size_t vertex) const
+{
+    return xs[vertex].data();
+}
+
+const float* TriangleArray::yData(std::size_t vertex) const
+{
+    return ys[vertex].data();
+}
+
+void TriangleArray::checkSameSize(const Vector2Array& points) const
+{
+    if (points.size() != size())
+    {
+        throw std::invalid_argument("The points and the TriangleArray must have the same size!");
+    }
+}
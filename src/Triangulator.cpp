@@ -0,0 +1,570 @@
+/**
+ * @file Triangulator.cpp
+ *
+ * @brief Implementation of the methods from the @c geometry::Triangulator class
+ *
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Triangulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+#include "geometry/internal/Orientation.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+namespace {
+    /**
+     * The polygon walked in counter-clockwise order, whatever the order of its vertices. Position k
+     * of the walk is the vertex @c vertices[index(k)].
+     */
+    struct Outline {
+        const Vector2* vertices;
+        std::size_t count;
+        bool reversed;
+
+        Outline(const Vector2* vertices, std::size_t count)
+            : vertices(vertices), count(count), reversed(false)
+        {
+            reversed = doubleSignedArea(vertices, count) < 0.0;
+        }
+
+        std::uint32_t index(std::size_t position) const
+        {
+            return static_cast<std::uint32_t>(reversed ? count - 1 - position : position);
+        }
+
+        const Vector2& at(std::size_t position) const
+        {
+            return vertices[index(position)];
+        }
+
+        std::size_t next(std::size_t position) const
+        {
+            return (position + 1 == count) ? 0 : position + 1;
+        }
+
+        std::size_t prev(std::size_t position) const
+        {
+            return (position == 0) ? count - 1 : position - 1;
+        }
+
+        /**
+         * Appends the triangle between three positions, turned counter-clockwise.
+         */
+        void emit(std::size_t first, std::size_t second, std::size_t third, std::vector<std::uint32_t>& indices) const
+        {
+            if (cross(at(first), at(second), at(third)) < 0.0)
+            {
+                std::swap(second, third);
+            }
+            indices.push_back(index(first));
+            indices.push_back(index(second));
+            indices.push_back(index(third));
+        }
+    };
+
+    bool insideTriangle(const Vector2& first, const Vector2& second, const Vector2& third, const Vector2& point)
+    {
+        return cross(first, second, point) >= 0.0 && cross(second, third, point) >= 0.0 && cross(third, first, point) >= 0.0;
+    }
+
+    /**
+     * The sweep goes from the top down, a point is above another one with the same y when it is to its left.
+     */
+    bool above(const Vector2& first, const Vector2& second)
+    {
+        return first.y > second.y || (first.y == second.y && first.x < second.x);
+    }
+
+    enum class VertexType {
+        Start,
+        End,
+        Split,
+        Merge,
+        Regular
+    };
+
+    /**
+     * The edges crossed by the sweep line, from left to right. Only edges going down, which have the
+     * interior of the polygon on their right, are ever inserted. Edge k goes from position k to position
+     * k + 1 and the key @c QUERY stands for the point being swept.
+     */
+    struct SweepOrder {
+        static constexpr std::size_t QUERY = static_cast<std::size_t>(-1);
+
+        const Outline* outline;
+        const double* sweepY;
+        const double* queryX;
+
+        double xAt(std::size_t edge) const
+        {
+            if (edge == QUERY)
+            {
+                return *queryX;
+            }
+
+            const Vector2& start = outline->at(edge);
+            const Vector2& end = outline->at(outline->next(edge));
+            if (start.y == end.y)
+            {
+                return std::min(start.x, end.x);
+            }
+
+            const double t = (*sweepY - start.y) / (static_cast<double>(end.y) - start.y);
+            return start.x + t * (static_cast<double>(end.x) - start.x);
+        }
+
+        bool operator()(std::size_t first, std::size_t second) const
+        {
+            const double firstX = xAt(first);
+            const double secondX = xAt(second);
+            if (firstX != secondX)
+            {
+                return firstX < secondX;
+            }
+            return first + 1 < second + 1;
+        }
+    };
+
+    /**
+     * Adds the diagonals that cut the polygon into y-monotone pieces, following the sweep of
+     * de Berg et al., "Computational Geometry", chapter 3.
+     */
+    void findDiagonals(const Outline& outline, std::vector<std::pair<std::size_t, std::size_t>>& diagonals)
+    {
+        const std::size_t count = outline.count;
+
+        std::vector<VertexType> types(count);
+        std::vector<std::size_t> events(count);
+        for (std::size_t position = 0; position < count; position++)
+        {
+            events[position] = position;
+
+            const Vector2& previous = outline.at(outline.prev(position));
+            const Vector2& current = outline.at(position);
+            const Vector2& next = outline.at(outline.next(position));
+            const bool convex = cross(previous, current, next) > 0.0;
+
+            if (above(current, previous) && above(current, next))
+            {
+                types[position] = convex ? VertexType::Start : VertexType::Split;
+            }
+            else if (above(previous, current) && above(next, current))
+            {
+                types[position] = convex ? VertexType::End : VertexType::Merge;
+            }
+            else
+            {
+                types[position] = VertexType::Regular;
+            }
+        }
+        std::sort(events.begin(), events.end(), [&outline](std::size_t first, std::size_t second) {
+            return above(outline.at(first), outline.at(second));
+        });
+
+        double sweepY = 0.0;
+        double queryX = 0.0;
+        using Status = std::set<std::size_t, SweepOrder>;
+        Status status(SweepOrder{&outline, &sweepY, &queryX});
+        std::vector<Status::iterator> edges(count, status.end());
+        std::vector<std::size_t> helpers(count, 0);
+
+        auto insertEdge = [&](std::size_t edge) {
+            edges[edge] = status.insert(edge).first;
+            helpers[edge] = edge;
+        };
+        auto closeEdge = [&](std::size_t position, std::size_t edge) {
+            if (edges[edge] == status.end())
+            {
+                throw std::runtime_error("The polygon is not simple!");
+            }
+            if (types[helpers[edge]] == VertexType::Merge)
+            {
+                diagonals.emplace_back(position, helpers[edge]);
+            }
+            status.erase(edges[edge]);
+            edges[edge] = status.end();
+        };
+        auto edgeLeftOf = [&](std::size_t position) {
+            queryX = outline.at(position).x;
+            auto edge = status.lower_bound(SweepOrder::QUERY);
+            if (edge == status.begin())
+            {
+                throw std::runtime_error("The polygon is not simple!");
+            }
+            return *std::prev(edge);
+        };
+
+        for (std::size_t position : events)
+        {
+            sweepY = outline.at(position).y;
+            const std::size_t previous = outline.prev(position);
+
+            switch (types[position])
+            {
+            case VertexType::Start:
+                insertEdge(position);
+                break;
+            case VertexType::End:
+                closeEdge(position, previous);
+                break;
+            case VertexType::Split:
+            {
+                const std::size_t left = edgeLeftOf(position);
+                diagonals.emplace_back(position, helpers[left]);
+                helpers[left] = position;
+                insertEdge(position);
+                break;
+            }
+            case VertexType::Merge:
+            {
+                closeEdge(position, previous);
+                const std::size_t left = edgeLeftOf(position);
+                if (types[helpers[left]] == VertexType::Merge)
+                {
+                    diagonals.emplace_back(position, helpers[left]);
+                }
+                helpers[left] = position;
+                break;
+            }
+            case VertexType::Regular:
+                if (above(outline.at(previous), outline.at(position)))
+                {
+                    // On the left boundary, the interior lies to the right
+                    closeEdge(position, previous);
+                    insertEdge(position);
+                }
+                else
+                {
+                    const std::size_t left = edgeLeftOf(position);
+                    if (types[helpers[left]] == VertexType::Merge)
+                    {
+                        diagonals.emplace_back(position, helpers[left]);
+                    }
+                    helpers[left] = position;
+                }
+                break;
+            }
+        }
+    }
+
+    /**
+     * Walks the faces the diagonals split the polygon into, each one counter-clockwise, and hands
+     * them to @p visit as lists of positions.
+     */
+    template <typename Visit>
+    void forEachPiece(const Outline& outline, const std::vector<std::pair<std::size_t, std::size_t>>& diagonals, Visit&& visit)
+    {
+        const std::size_t count = outline.count;
+
+        // Outgoing half-edges of every position, sorted counter-clockwise by angle
+        struct HalfEdge {
+            std::size_t target;
+            double angle;
+            bool used;
+        };
+        std::vector<std::vector<HalfEdge>> outgoing(count);
+        auto addHalfEdge = [&](std::size_t from, std::size_t to) {
+            const Vector2& start = outline.at(from);
+            const Vector2& end = outline.at(to);
+            outgoing[from].push_back({to, std::atan2(static_cast<double>(end.y) - start.y, static_cast<double>(end.x) - start.x), false});
+        };
+        for (std::size_t position = 0; position < count; position++)
+        {
+            addHalfEdge(position, outline.next(position));
+        }
+        for (const auto& diagonal : diagonals)
+        {
+            addHalfEdge(diagonal.first, diagonal.second);
+            addHalfEdge(diagonal.second, diagonal.first);
+        }
+        for (auto& edges : outgoing)
+        {
+            std::sort(edges.begin(), edges.end(), [](const HalfEdge& first, const HalfEdge& second) {
+                return first.angle < second.angle;
+            });
+        }
+
+        // Arriving at a vertex, the face continues along the first edge clockwise from the way back
+        auto following = [&](std::size_t from, std::size_t at) {
+            const Vector2& start = outline.at(at);
+            const Vector2& end = outline.at(from);
+            const double back = std::atan2(static_cast<double>(end.y) - start.y, static_cast<double>(end.x) - start.x);
+
+            const auto& edges = outgoing[at];
+            std::size_t chosen = edges.size() - 1;
+            for (std::size_t i = edges.size(); i-- > 0;)
+            {
+                if (edges[i].angle < back)
+                {
+                    chosen = i;
+                    break;
+                }
+            }
+            return chosen;
+        };
+
+        const std::size_t halfEdgeCount = count + 2 * diagonals.size();
+        std::vector<std::size_t> piece;
+        for (std::size_t position = 0; position < count; position++)
+        {
+            for (std::size_t edge = 0; edge < outgoing[position].size(); edge++)
+            {
+                if (outgoing[position][edge].used)
+                {
+                    continue;
+                }
+
+                piece.clear();
+                std::size_t current = position;
+                std::size_t currentEdge = edge;
+                while (!outgoing[current][currentEdge].used)
+                {
+                    if (piece.size() == halfEdgeCount)
+                    {
+                        throw std::runtime_error("The polygon is not simple!");
+                    }
+                    outgoing[current][currentEdge].used = true;
+                    piece.push_back(current);
+
+                    const std::size_t target = outgoing[current][currentEdge].target;
+                    currentEdge = following(current, target);
+                    current = target;
+                }
+                visit(piece);
+            }
+        }
+    }
+
+    /**
+     * Triangulates a y-monotone piece in linear time, with the stack of reflex vertices from
+     * de Berg et al., "Computational Geometry", chapter 3.
+     */
+    void triangulateMonotone(const Outline& outline, const std::vector<std::size_t>& piece, std::vector<std::size_t>& sorted,
+        std::vector<bool>& onLeftChain, std::vector<std::size_t>& stack, std::vector<std::uint32_t>& indices)
+    {
+        const std::size_t count = piece.size();
+        if (count < 3)
+        {
+            return;
+        }
+        if (count == 3)
+        {
+            outline.emit(piece[0], piece[1], piece[2], indices);
+            return;
+        }
+
+        std::size_t top = 0;
+        for (std::size_t i = 1; i < count; i++)
+        {
+            if (above(outline.at(piece[i]), outline.at(piece[top])))
+            {
+                top = i;
+            }
+        }
+
+        // Going forward from the top walks down the left chain, going backward walks down the right one
+        sorted.clear();
+        onLeftChain.assign(count, false);
+        sorted.push_back(top);
+        std::size_t left = (top + 1) % count;
+        std::size_t right = (top + count - 1) % count;
+        while (sorted.size() < count)
+        {
+            if (left != right && above(outline.at(piece[right]), outline.at(piece[left])))
+            {
+                sorted.push_back(right);
+                right = (right + count - 1) % count;
+            }
+            else
+            {
+                onLeftChain[left] = true;
+                sorted.push_back(left);
+                left = (left + 1) % count;
+            }
+        }
+
+        stack.clear();
+        stack.push_back(sorted[0]);
+        stack.push_back(sorted[1]);
+        for (std::size_t j = 2; j + 1 < count; j++)
+        {
+            const std::size_t current = sorted[j];
+            if (onLeftChain[current] != onLeftChain[stack.back()])
+            {
+                for (std::size_t i = stack.size() - 1; i > 0; i--)
+                {
+                    outline.emit(piece[current], piece[stack[i]], piece[stack[i - 1]], indices);
+                }
+                stack.clear();
+                stack.push_back(sorted[j - 1]);
+                stack.push_back(current);
+            }
+            else
+            {
+                std::size_t last = stack.back();
+                stack.pop_back();
+                while (!stack.empty())
+                {
+                    const Vector2& upper = outline.at(piece[stack.back()]);
+                    const Vector2& middle = outline.at(piece[last]);
+                    const Vector2& lower = outline.at(piece[current]);
+                    const bool inside = onLeftChain[current] ? cross(upper, middle, lower) > 0.0 : cross(lower, middle, upper) > 0.0;
+                    if (!inside)
+                    {
+                        break;
+                    }
+
+                    outline.emit(piece[current], piece[last], piece[stack.back()], indices);
+                    last = stack.back();
+                    stack.pop_back();
+                }
+                stack.push_back(last);
+                stack.push_back(current);
+            }
+        }
+
+        const std::size_t bottom = sorted[count - 1];
+        for (std::size_t i = stack.size() - 1; i > 0; i--)
+        {
+            outline.emit(piece[bottom], piece[stack[i]], piece[stack[i - 1]], indices);
+        }
+    }
+}
+
+std::size_t Triangulator::triangulate(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices)
+{
+    if (count <= EAR_CLIPPING_LIMIT)
+    {
+        return earClipping(vertices, count, indices);
+    }
+    return monotonePartition(vertices, count, indices);
+}
+
+std::size_t Triangulator::earClipping(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices)
+{
+    indices.clear();
+    if (count < 3)
+    {
+        return 0;
+    }
+
+    const Outline outline(vertices, count);
+    std::vector<std::size_t> previous(count);
+    std::vector<std::size_t> next(count);
+    for (std::size_t position = 0; position < count; position++)
+    {
+        previous[position] = outline.prev(position);
+        next[position] = outline.next(position);
+    }
+
+    auto isEar = [&](std::size_t position) {
+        const Vector2& first = outline.at(previous[position]);
+        const Vector2& second = outline.at(position);
+        const Vector2& third = outline.at(next[position]);
+        if (cross(first, second, third) <= 0.0)
+        {
+            return false;
+        }
+
+        for (std::size_t other = next[next[position]]; other != previous[position]; other = next[other])
+        {
+            const Vector2& point = outline.at(other);
+            if (point == first || point == second || point == third)
+            {
+                continue;
+            }
+            if (insideTriangle(first, second, third, point))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto clip = [&](std::size_t position) {
+        next[previous[position]] = next[position];
+        previous[next[position]] = previous[position];
+    };
+
+    indices.reserve(3 * (count - 2));
+    std::size_t remaining = count;
+    std::size_t position = 0;
+    std::size_t misses = 0;
+    while (remaining > 3)
+    {
+        if (isEar(position))
+        {
+            outline.emit(previous[position], position, next[position], indices);
+            clip(position);
+            remaining--;
+            position = next[position];
+            misses = 0;
+            continue;
+        }
+
+        position = next[position];
+        if (++misses < remaining)
+        {
+            continue;
+        }
+
+        // No ear left, a simple polygon can only get here through collinear vertices, which are dropped
+        std::size_t flat = position;
+        while (cross(outline.at(previous[flat]), outline.at(flat), outline.at(next[flat])) != 0.0)
+        {
+            flat = next[flat];
+            if (flat == position)
+            {
+                throw std::runtime_error("The polygon is not simple!");
+            }
+        }
+        clip(flat);
+        remaining--;
+        position = next[flat];
+        misses = 0;
+    }
+    outline.emit(previous[position], position, next[position], indices);
+
+    return indices.size() / 3;
+}
+
+std::size_t Triangulator::monotonePartition(const Vector2* vertices, std::size_t count, std::vector<std::uint32_t>& indices)
+{
+    indices.clear();
+    if (count < 3)
+    {
+        return 0;
+    }
+
+    const Outline outline(vertices, count);
+    std::vector<std::pair<std::size_t, std::size_t>> diagonals;
+    findDiagonals(outline, diagonals);
+
+    indices.reserve(3 * (count - 2));
+    std::vector<std::size_t> sorted;
+    std::vector<bool> onLeftChain;
+    std::vector<std::size_t> stack;
+    forEachPiece(outline, diagonals, [&](const std::vector<std::size_t>& piece) {
+        triangulateMonotone(outline, piece, sorted, onLeftChain, stack, indices);
+    });
+
+    return indices.size() / 3;
+}
+
+void Triangulator::triangulateAll(const std::vector<const Polygon*>& polygons, std::vector<std::vector<std::uint32_t>>& indices, ThreadPool& pool)
+{
+    indices.resize(polygons.size());
+    pool.parallelFor(polygons.size(), 1, [&polygons, &indices](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            polygons[i]->triangulate(indices[i]);
+        }
+    });
+}
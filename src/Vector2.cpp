@@ -8,295 +8,129 @@
 
 using namespace geometry;
 
-Vector2::Vector2(float x, float y)
-    : x(x), y(y)
+template <typename T>
+T BasicVector2<T>::lenght() const
 {
-
-}
-
-Vector2::Vector2(const Vector2& src)
-    : x(src.x), y(src.y)
-{
-
-}
-
-Vector2::~Vector2()
-{
-
-}
-
-float Vector2::lenght() const
-{
-    if (!cache.lenght.has_value())
-    {
-        cache.lenght.emplace(std::sqrt(x*x + y*y));
-        
-    }
-    return cache.lenght.value();
+    return ScalarTraits<T>::hypot(x, y);
 }
 
-float Vector2::sinTheta() const 
+template <typename T>
+T BasicVector2<T>::sinTheta() const 
 {
-    if (floatEq(this->lenght(), 0.0f))
+    T lenght = this->lenght();
+    if (scalarEq(lenght, T(0)))
     {
         throw std::runtime_error("Can't compute sin of vector with lenght 0!\nUse isNull() method to check for zero lenght vector");
     }
 
-    if (!cache.sinTheta.has_value())
-    {
-        cache.sinTheta.emplace(y / this->lenght());
-    }
-    return cache.sinTheta.value();
+    return y / lenght;
 }
 
-float Vector2::cosTheta() const
+template <typename T>
+T BasicVector2<T>::cosTheta() const
 {
-    if ( floatEq(this->lenght(), 0.0f) )
+    T lenght = this->lenght();
+    if ( scalarEq(lenght, T(0)) )
     {
         throw std::runtime_error("Can't compute cos of vector with lenght 0!\nUse isNull() method to check for zero lenght vector");
     }
 
-    if (!cache.cosTheta.has_value())
-    {
-        cache.cosTheta.emplace(x / this->lenght());
-    }
-    return cache.cosTheta.value();
-}
-
-float Vector2::dot(const Vector2& other) const
-{
-    return this->x * other.x + this->y * other.y;
+    return x / lenght;
 }
 
-float Vector2::angleBetween(const Vector2& other)
+template <typename T>
+T BasicVector2<T>::angleBetween(const BasicVector2& other)
 {
-    if (floatEq(this->lenght(), 0.0f) || floatEq(other.lenght(), 0.0f))
+    if (scalarEq(this->lenght(), T(0)) || scalarEq(other.lenght(), T(0)))
     {
         throw std::runtime_error("Can't compute the angle between two vectors if atleast one of them is (0, 0)!\nUse isNull() to check for null vector!\n");
     }
 
-    return std::acos(this->dot(other) / (this->lenght() * other.lenght()));
+    return ScalarTraits<T>::acos(this->dot(other) / (this->lenght() * other.lenght()));
 }
 
-Vector2 Vector2::normalized() const
+template <typename T>
+BasicVector2<T> BasicVector2<T>::normalized() const
 {
-    float lenght = lenght();
-    if (lenght <= FLOAT_EPSILON)
+    T lenght = this->lenght();
+    if (lenght <= ScalarTraits<T>::epsilon())
     {
-        return Vector2(0.0f, 0.0f);
+        return BasicVector2(T(0), T(0));
     }
-    return Vector2(x/lenght, y/lenght);
-}
-
-Vector2 Vector2::rotatedBy(float thetaRadians) const
-{
-    float sinTheta = std::sin(thetaRadians);
-    float cosTheta = std::cos(thetaRadians);
-    return Vector2(x * cosTheta - y * sinTheta, x * sinTheta + y * cosTheta);
-}
-
-Vector2 Vector2::scaledBy(float scalar) const
-{
-    return Vector2(scalar * x, scalar * y);
+    return BasicVector2(x/lenght, y/lenght);
 }
 
-bool Vector2::isEqual(const Vector2& other) const
+template <typename T>
+BasicVector2<T> BasicVector2<T>::rotatedBy(T thetaRadians) const
 {
-    return floatEq(this->x, other.y) && floatEq(this->y, other.y);
+    T sinTheta = ScalarTraits<T>::sin(thetaRadians);
+    T cosTheta = ScalarTraits<T>::cos(thetaRadians);
+    return BasicVector2(x * cosTheta - y * sinTheta, x * sinTheta + y * cosTheta);
 }
 
-bool Vector2::isLessThan(const Vector2& other) const
+template <typename T>
+bool BasicVector2<T>::isLessThan(const BasicVector2& other) const
 {
     return this->lenght() < other.lenght();
 }
 
-bool Vector2::isGreaterThan(const Vector2& other) const
+template <typename T>
+bool BasicVector2<T>::isGreaterThan(const BasicVector2& other) const
 {
     return this->lenght() > other.lenght();
 }
 
-bool Vector2::isNull() const
+template <typename T>
+BasicVector2<T>& BasicVector2<T>::normalize()
 {
-    return (x <= FLOAT_EPSILON) && (y <= FLOAT_EPSILON);
-}
-
-Vector2& Vector2::moveTo(const float x, const float y)
-{
-    this->x = x;
-    this->y = y;
-
-    cache.invalidate();
-    return *this;
-}
-
-Vector2& Vector2::normalize()
-{
-    float lenght = this->lenght();
+    T lenght = this->lenght();
 
-    if (lenght > FLOAT_EPSILON)
+    if (lenght > ScalarTraits<T>::epsilon())
     {
         x /= lenght;
         y /= lenght;
     }
 
-    cache.invalidate();
     return *this;
 }
 
-Vector2& Vector2::rotateBy(float radians)
+template <typename T>
+BasicVector2<T>& BasicVector2<T>::rotateBy(T radians)
 {
-    float sinTheta = std::sin(radians);
-    float cosTheta = std::cos(radians);
-    float oldX = x;
+    T sinTheta = ScalarTraits<T>::sin(radians);
+    T cosTheta = ScalarTraits<T>::cos(radians);
+    T oldX = x;
 
     x = x * cosTheta - y * sinTheta;
     y = oldX * sinTheta + y * cosTheta;    
 
-    cache.invalidate();
-    return *this;
-}
-
-Vector2& Vector2::scaleBy(float scalar)
-{
-    x *= scalar;
-    y *= scalar;
-
-    cache.invalidate();
-    return *this;
-}
-
-Vector2& Vector2::add(const Vector2& other)
-{
-    this->x += other.x;
-    this->y += other.y;
-
-    cache.invalidate();
-    return *this;
-}
-
-Vector2& Vector2::subtract(const Vector2& other)
-{
-    this->x -= other.x;
-    this->y -= other.y;
-
-    cache.invalidate();
-    return *this;
-}
-
-Vector2& Vector2::precompute()
-{
-    if(!cache.lenght.has_value())
-    {
-        cache.lenght.emplace(this->lenght());
-    }
-    if (!cache.cosTheta.has_value())
-    {
-        cache.cosTheta.emplace(this->cosTheta());
-    }
-    if (!cache.sinTheta.has_value())
-    {
-        cache.sinTheta.emplace(this->sinTheta());
-    }
-
     return *this;
 }
 
-bool Vector2::operator ==(const Vector2& other) const
-{
-    return this->isEqual(other);
-}
-
-bool Vector2::operator !=(const Vector2& other) const
-{
-    return !this->isEqual(other);
-}
-
-bool Vector2::operator <(const Vector2& other) const
+template <typename T>
+bool BasicVector2<T>::operator <(const BasicVector2& other) const
 {
     return isLessThan(other);
 }
 
-bool Vector2::operator >(const Vector2& other) const
+template <typename T>
+bool BasicVector2<T>::operator >(const BasicVector2& other) const
 {
     return isGreaterThan(other);
 }
 
-bool Vector2::operator <=(const Vector2& other) const
-{
-    return isLessThan(other) || (floatEq(this->lenght(), other.lenght()));
-}
-
-bool Vector2::operator >=(const Vector2& other) const
-{
-    return isGreaterThan(other) || (floatEq(this->lenght(), other.lenght()));
-}
-
-Vector2 Vector2::operator -() const
-{
-    return *this * (-1.0f);
-}
-
-Vector2 Vector2::operator +() const
-{
-    return Vector2(*this);
-}
-
-Vector2 Vector2::operator +(const Vector2& other) const
-{
-    return Vector2(this->x + other.x, this->y + other.y);
-}
-
-Vector2 Vector2::operator -(const Vector2& other) const
-{
-    return Vector2(this->x - other.x, this->y - other.y);
-}
-
-Vector2 Vector2::operator *(const float scalar) const
-{
-    return Vector2(this->x * scalar, this->y * scalar);
-}
-
-Vector2 Vector2::operator /(const float scalar) const
+template <typename T>
+bool BasicVector2<T>::operator <=(const BasicVector2& other) const
 {
-    return Vector2(this->x / scalar, this->y / scalar);
+    return isLessThan(other) || (scalarEq(this->lenght(), other.lenght()));
 }
 
-Vector2& Vector2::operator =(const Vector2& src)
+template <typename T>
+bool BasicVector2<T>::operator >=(const BasicVector2& other) const
 {
-    this->x = src.x;
-    this->y = src.y;
-
-    return *this;
-}
-
-Vector2& Vector2::operator +=(const Vector2& other)
-{
-    this->x += other.x;
-    this->y += other.y;
-
-    return *this;
+    return isGreaterThan(other) || (scalarEq(this->lenght(), other.lenght()));
 }
 
-Vector2& Vector2::operator -=(const Vector2& other)
-{
-    this->x -= other.x;
-    this->y -= other.y;
-
-    return *this;
-}
-
-Vector2& Vector2::operator *=(const float scalar)
-{
-    this->x *= scalar;
-    this->y *= scalar;
-
-    return *this;
-}
-
-Vector2& Vector2::operator /=(const float scalar)
-{
-    this->x /= scalar;
-    this->y /= scalar;
-
-    return *this;
-}
\ No newline at end of file
+template struct geometry::BasicVector2<float>;
+template struct geometry::BasicVector2<double>;
+template struct geometry::BasicVector2<Fixed>;
@@ -0,0 +1,331 @@
+/**
+ * @file Vector2Array.cpp
+ * 
+ * @brief Implementation of the methods from the @c geometry::Vector2Array class
+ * 
+ * Every bulk operation runs a vectorized loop over @c internal::simd::WIDTH vectors at a time and
+ * finishes the remaining tail with scalar code.
+ * 
+ * @author Filip Andrei
+ * @date 16-10-2026
+ */
+
+#include "geometry/Vector2Array.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/internal/common.hpp"
+
+using namespace geometry;
+using namespace geometry::internal;
+
+Vector2Array::Vector2Array(std::size_t size)
+    : xs(size, 0.0f), ys(size, 0.0f)
+{
+
+}
+
+Vector2Array::Vector2Array(const std::vector<Vector2>& vectors)
+    : xs(vectors.size()), ys(vectors.size())
+{
+    for (std::size_t i = 0; i < vectors.size(); i++)
+    {
+        xs[i] = vectors[i].x;
+        ys[i] = vectors[i].y;
+    }
+}
+
+std::size_t Vector2Array::size() const
+{
+    return xs.size();
+}
+
+bool Vector2Array::empty() const
+{
+    return xs.empty();
+}
+
+Vector2 Vector2Array::get(std::size_t index) const
+{
+    return Vector2(xs[index], ys[index]);
+}
+
+std::vector<Vector2> Vector2Array::toVector() const
+{
+    std::vector<Vector2> vectors(xs.size());
+    for (std::size_t i = 0; i < xs.size(); i++)
+    {
+        vectors[i] = Vector2(xs[i], ys[i]);
+    }
+    return vectors;
+}
+
+void Vector2Array::dot(const Vector2Array& other, std::vector<float>& out) const
+{
+    checkSameSize(other);
+    out.resize(size());
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack products = simd::load(&xs[i]) * simd::load(&other.xs[i]) + simd::load(&ys[i]) * simd::load(&other.ys[i]);
+        simd::storeu(&out[i], products);
+    }
+    for (; i < count; i++)
+    {
+        out[i] = xs[i] * other.xs[i] + ys[i] * other.ys[i];
+    }
+}
+
+void Vector2Array::lenght(std::vector<float>& out) const
+{
+    out.resize(size());
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack x = simd::load(&xs[i]);
+        simd::Pack y = simd::load(&ys[i]);
+        simd::storeu(&out[i], simd::sqrt(x * x + y * y));
+    }
+    for (; i < count; i++)
+    {
+        out[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+    }
+}
+
+void Vector2Array::reserve(std::size_t capacity)
+{
+    xs.reserve(capacity);
+    ys.reserve(capacity);
+}
+
+void Vector2Array::resize(std::size_t size)
+{
+    xs.resize(size, 0.0f);
+    ys.resize(size, 0.0f);
+}
+
+void Vector2Array::clear()
+{
+    xs.clear();
+    ys.clear();
+}
+
+void Vector2Array::push_back(const Vector2& vector)
+{
+    xs.push_back(vector.x);
+    ys.push_back(vector.y);
+}
+
+Vector2Array& Vector2Array::set(std::size_t index, const Vector2& vector)
+{
+    xs[index] = vector.x;
+    ys[index] = vector.y;
+    return *this;
+}
+
+Vector2Array& Vector2Array::add(const Vector2Array& other)
+{
+    checkSameSize(other);
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::store(&xs[i], simd::load(&xs[i]) + simd::load(&other.xs[i]));
+        simd::store(&ys[i], simd::load(&ys[i]) + simd::load(&other.ys[i]));
+    }
+    for (; i < count; i++)
+    {
+        xs[i] += other.xs[i];
+        ys[i] += other.ys[i];
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::add(const Vector2& offset)
+{
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack offsetX = simd::broadcast(offset.x);
+    const simd::Pack offsetY = simd::broadcast(offset.y);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::store(&xs[i], simd::load(&xs[i]) + offsetX);
+        simd::store(&ys[i], simd::load(&ys[i]) + offsetY);
+    }
+    for (; i < count; i++)
+    {
+        xs[i] += offset.x;
+        ys[i] += offset.y;
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::subtract(const Vector2Array& other)
+{
+    checkSameSize(other);
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::store(&xs[i], simd::load(&xs[i]) - simd::load(&other.xs[i]));
+        simd::store(&ys[i], simd::load(&ys[i]) - simd::load(&other.ys[i]));
+    }
+    for (; i < count; i++)
+    {
+        xs[i] -= other.xs[i];
+        ys[i] -= other.ys[i];
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::subtract(const Vector2& offset)
+{
+    return add(-offset);
+}
+
+Vector2Array& Vector2Array::scaleBy(float scalar)
+{
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack factor = simd::broadcast(scalar);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::store(&xs[i], simd::load(&xs[i]) * factor);
+        simd::store(&ys[i], simd::load(&ys[i]) * factor);
+    }
+    for (; i < count; i++)
+    {
+        xs[i] *= scalar;
+        ys[i] *= scalar;
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::normalize()
+{
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack epsilon = simd::broadcast(FLOAT_EPSILON);
+    const simd::Pack one = simd::broadcast(1.0f);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack x = simd::load(&xs[i]);
+        simd::Pack y = simd::load(&ys[i]);
+        simd::Pack lenght = simd::sqrt(x * x + y * y);
+
+        // Null vectors are divided by 1 so they stay unchanged.
+        simd::Pack divisor = simd::select(simd::greaterThan(lenght, epsilon), lenght, one);
+        simd::store(&xs[i], x / divisor);
+        simd::store(&ys[i], y / divisor);
+    }
+    for (; i < count; i++)
+    {
+        float lenght = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+        if (lenght > FLOAT_EPSILON)
+        {
+            xs[i] /= lenght;
+            ys[i] /= lenght;
+        }
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::rotateBy(float angleRadians)
+{
+    const float sinTheta = std::sin(angleRadians);
+    const float cosTheta = std::cos(angleRadians);
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack sinPack = simd::broadcast(sinTheta);
+    const simd::Pack cosPack = simd::broadcast(cosTheta);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack x = simd::load(&xs[i]);
+        simd::Pack y = simd::load(&ys[i]);
+        simd::store(&xs[i], x * cosPack - y * sinPack);
+        simd::store(&ys[i], x * sinPack + y * cosPack);
+    }
+    for (; i < count; i++)
+    {
+        float oldX = xs[i];
+        xs[i] = oldX * cosTheta - ys[i] * sinTheta;
+        ys[i] = oldX * sinTheta + ys[i] * cosTheta;
+    }
+    return *this;
+}
+
+Vector2Array& Vector2Array::lerp(const Vector2Array& target, float t)
+{
+    checkSameSize(target);
+
+    const std::size_t count = size();
+    const std::size_t packed = simd::packedEnd(count);
+    const simd::Pack factor = simd::broadcast(t);
+    std::size_t i = 0;
+
+    for (; i < packed; i += simd::WIDTH)
+    {
+        simd::Pack x = simd::load(&xs[i]);
+        simd::Pack y = simd::load(&ys[i]);
+        simd::store(&xs[i], x + (simd::load(&target.xs[i]) - x) * factor);
+        simd::store(&ys[i], y + (simd::load(&target.ys[i]) - y) * factor);
+    }
+    for (; i < count; i++)
+    {
+        xs[i] += (target.xs[i] - xs[i]) * t;
+        ys[i] += (target.ys[i] - ys[i]) * t;
+    }
+    return *this;
+}
+
+float* Vector2Array::xData()
+{
+    return xs.data();
+}
+
+const float* Vector2Array::xData() const
+{
+    return xs.data();
+}
+
+float* Vector2Array::yData()
+{
+    return ys.data();
+}
+
+const float* Vector2Array::yData() const
+{
+    return ys.data();
+}
+
+void Vector2Array::checkSameSize(const Vector2Array& other) const
+{
+    if (other.size() != this->size())
+    {
+        throw std::invalid_argument("The two Vector2Array objects must have the same size!");
+    }
+}
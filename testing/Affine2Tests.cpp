@@ -0,0 +1,85 @@
+#include "geometry/Affine2.hpp"
+#include "geometry/Polygon.hpp"
+#include "geometry/Rect.hpp"
+#include "geometry/Vector2Array.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    void expectNear(const geometry::Vector2& actual, const geometry::Vector2& expected)
+    {
+        EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+        EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+    }
+}
+
+TEST(Affine2Tests, ComposedChainMatchesSeparateOperations)
+{
+    auto transform = geometry::Affine2().rotate(0.7f).scale(2.0f).translate(geometry::Vector2(3.0f, -1.0f));
+
+    geometry::Vector2 point(1.5f, -2.5f);
+    geometry::Vector2 expected = point.rotatedBy(0.7f).scaledBy(2.0f) + geometry::Vector2(3.0f, -1.0f);
+
+    expectNear(transform.apply(point), expected);
+    expectNear(transform.inverse().apply(transform.apply(point)), point);
+}
+
+TEST(Affine2Tests, BulkApplyMatchesSingleApply)
+{
+    auto transform = geometry::Affine2::rotation(1.2f, geometry::Vector2(4.0f, 4.0f)).then(geometry::Affine2::scaling(0.5f, 3.0f));
+
+    std::vector<geometry::Vector2> points;
+    for (int i = 0; i < 37; i++)
+    {
+        points.emplace_back(0.25f * i, 10.0f - 0.5f * i);
+    }
+
+    auto aos = points;
+    transform.apply(aos);
+
+    geometry::Vector2Array soa(points);
+    transform.apply(soa);
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        expectNear(aos[i], transform.apply(points[i]));
+        expectNear(soa.get(i), transform.apply(points[i]));
+    }
+}
+
+TEST(Affine2Tests, PolygonTransformMovesEveryVertex)
+{
+    geometry::Polygon polygon({0.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 2.0f}, geometry::Vector2(0.0f, 2.0f));
+    polygon.transform(geometry::Affine2::translation({5.0f, 1.0f}));
+
+    expectNear(polygon.getVertices()[2], geometry::Vector2(7.0f, 3.0f));
+    expectNear(polygon.center(), geometry::Vector2(6.0f, 2.0f));
+
+    // The normals and sums follow a rotation and scaling done in the same pass
+    polygon.transform(geometry::Affine2::rotation(static_cast<float>(M_PI) / 2.0f, geometry::Vector2(6.0f, 2.0f)).scale(3.0f));
+    EXPECT_NEAR(polygon.area(), 36.0, 1e-3);
+    EXPECT_NEAR(polygon.perimeter(), 24.0, 1e-3);
+    expectNear(polygon.getEdgeNormals()[0], geometry::Vector2(1.0f, 0.0f));
+    expectNear(polygon.bounds().getPosition(), geometry::Vector2(15.0f, 3.0f));
+}
+
+TEST(Affine2Tests, RectBoundsAreExact)
+{
+    geometry::Rect rect(0.0f, 0.0f, 2.0f, 1.0f);
+
+    geometry::Rect bounds = geometry::Affine2::rotation(static_cast<float>(M_PI) / 2.0f).apply(rect);
+    EXPECT_NEAR(bounds.getPosition().x, -1.0f, 1e-5f);
+    EXPECT_NEAR(bounds.getPosition().y, 0.0f, 1e-5f);
+    EXPECT_NEAR(bounds.getWidth(), 1.0f, 1e-5f);
+    EXPECT_NEAR(bounds.getHeight(), 2.0f, 1e-5f);
+
+    geometry::Rect mirrored = geometry::Affine2::scaling(-1.0f, 2.0f).apply(rect);
+    EXPECT_NEAR(mirrored.getPosition().x, -2.0f, 1e-5f);
+    EXPECT_NEAR(mirrored.getHeight(), 2.0f, 1e-5f);
+}
+
+TEST(Affine2Tests, SingularInverseThrows)
+{
+    ASSERT_THROW(geometry::Affine2::scaling(0.0f).inverse(), std::runtime_error);
+}
@@ -0,0 +1,100 @@
+#include "geometry/CircleSet.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace {
+    std::vector<geometry::Circle> makeCircles(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> position(0.0f, 100.0f);
+        std::uniform_real_distribution<float> radius(0.2f, 4.0f);
+
+        std::vector<geometry::Circle> circles;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            circles.emplace_back(geometry::Vector2(position(generator), position(generator)), radius(generator));
+        }
+        return circles;
+    }
+}
+
+TEST(CircleSetTests, ScalarCircleQueries)
+{
+    geometry::Circle circle({0.0f, 0.0f}, 2.0f);
+
+    ASSERT_TRUE(circle.contains({2.0f, 0.0f}));
+    ASSERT_FALSE(circle.contains({1.5f, 1.5f}));
+    ASSERT_TRUE(circle.overlaps(geometry::Circle({3.0f, 0.0f}, 1.0f)));
+    ASSERT_FALSE(circle.overlaps(geometry::Circle({3.0f, 3.0f}, 1.0f)));
+    ASSERT_TRUE(circle.overlaps(geometry::Rect(1.0f, 1.0f, 5.0f, 5.0f)));
+    ASSERT_FALSE(circle.overlaps(geometry::Rect(1.5f, 1.5f, 5.0f, 5.0f)));
+}
+
+TEST(CircleSetTests, BatchQueriesMatchScalar)
+{
+    auto circles = makeCircles(1003, 2);
+    geometry::CircleSet set(circles);
+
+    const geometry::Circle probe({50.0f, 50.0f}, 10.0f);
+    const geometry::Rect region(20.0f, 30.0f, 25.0f, 10.0f);
+    const geometry::Vector2 point(60.0f, 40.0f);
+
+    std::vector<std::uint32_t> expectedCircles, expectedRects, expectedPoints;
+    for (std::uint32_t i = 0; i < circles.size(); i++)
+    {
+        if (circles[i].overlaps(probe))
+        {
+            expectedCircles.push_back(i);
+        }
+        if (circles[i].overlaps(region))
+        {
+            expectedRects.push_back(i);
+        }
+        if (circles[i].contains(point))
+        {
+            expectedPoints.push_back(i);
+        }
+    }
+    ASSERT_FALSE(expectedCircles.empty());
+    ASSERT_FALSE(expectedRects.empty());
+
+    std::vector<std::uint32_t> hits;
+    set.findOverlapping(probe, hits);
+    ASSERT_EQ(hits, expectedCircles);
+    set.findOverlapping(region, hits);
+    ASSERT_EQ(hits, expectedRects);
+    set.findContaining(point, hits);
+    ASSERT_EQ(hits, expectedPoints);
+}
+
+TEST(CircleSetTests, PairsMatchScalar)
+{
+    auto circles = makeCircles(600, 7);
+    auto others = makeCircles(77, 8);
+    geometry::CircleSet set(circles), otherSet(others);
+
+    std::vector<geometry::IndexPair> expected, expectedBetween;
+    for (std::uint32_t i = 0; i < circles.size(); i++)
+    {
+        for (std::uint32_t j = i + 1; j < circles.size(); j++)
+        {
+            if (circles[i].overlaps(circles[j]))
+            {
+                expectedBetween.push_back({i, j});
+            }
+        }
+        for (std::uint32_t j = 0; j < others.size(); j++)
+        {
+            if (circles[i].overlaps(others[j]))
+            {
+                expected.push_back({i, j});
+            }
+        }
+    }
+
+    std::vector<geometry::IndexPair> pairs;
+    set.findOverlappingPairs(pairs);
+    ASSERT_EQ(pairs, expectedBetween);
+    set.findOverlappingPairs(otherSet, pairs);
+    ASSERT_EQ(pairs, expected);
+}
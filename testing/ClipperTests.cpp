@@ -0,0 +1,192 @@
+#include "geometry/Clipper.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace {
+    std::vector<geometry::Vector2> makeSquare(float x, float y, float size)
+    {
+        return {{x, y}, {x + size, y}, {x + size, y + size}, {x, y + size}};
+    }
+
+    std::vector<geometry::Vector2> makeRandomStar(int count, float centerX, float centerY, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> radius(2.0f, 10.0f);
+        std::vector<geometry::Vector2> vertices;
+        for (int i = 0; i < count; i++)
+        {
+            const float angle = 2.0f * 3.14159265f * i / count;
+            const float r = radius(generator);
+            vertices.emplace_back(centerX + r * std::cos(angle), centerY + r * std::sin(angle));
+        }
+        return vertices;
+    }
+
+    double area(const std::vector<geometry::Vector2>& vertices)
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < vertices.size(); i++)
+        {
+            const geometry::Vector2& current = vertices[i];
+            const geometry::Vector2& next = vertices[(i + 1) % vertices.size()];
+            sum += static_cast<double>(current.x) * next.y - static_cast<double>(next.x) * current.y;
+        }
+        return std::fabs(sum) / 2.0;
+    }
+
+    double compute(geometry::Clipper& clipper, geometry::BooleanOperation operation,
+        const std::vector<geometry::Vector2>& subject, const std::vector<geometry::Vector2>& clip)
+    {
+        geometry::Contours output;
+        clipper.compute(operation, subject.data(), subject.size(), clip.data(), clip.size(), output);
+        return output.area();
+    }
+}
+
+TEST(ClipperTests, ClipsAgainstARect)
+{
+    geometry::Clipper clipper;
+    geometry::Rect rect(1.0f, 1.0f, 4.0f, 4.0f);
+    std::vector<geometry::Vector2> output;
+
+    std::vector<geometry::Vector2> overlapping = makeSquare(0.0f, 0.0f, 2.0f);
+    EXPECT_EQ(clipper.clip(overlapping.data(), overlapping.size(), rect, output), 4u);
+    EXPECT_NEAR(area(output), 1.0, 1e-6);
+
+    std::vector<geometry::Vector2> inside = makeSquare(2.0f, 2.0f, 1.0f);
+    EXPECT_EQ(clipper.clip(inside.data(), inside.size(), rect, output), 4u);
+    EXPECT_EQ(output, inside);
+
+    std::vector<geometry::Vector2> outside = makeSquare(10.0f, 10.0f, 1.0f);
+    EXPECT_EQ(clipper.clip(outside.data(), outside.size(), rect, output), 0u);
+    EXPECT_TRUE(output.empty());
+
+    geometry::Polygon triangle(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(6.0f, 0.0f), geometry::Vector2(0.0f, 6.0f));
+    clipper.clip(triangle, rect, output);
+    EXPECT_NEAR(area(output), 8.0, 1e-5);
+}
+
+TEST(ClipperTests, RectClippingMatchesTheBooleanIntersection)
+{
+    geometry::Clipper clipper;
+    geometry::Rect rect(-3.0f, -4.0f, 7.0f, 6.0f);
+    std::vector<geometry::Vector2> rectVertices = makeSquare(-3.0f, -4.0f, 1.0f);
+    rectVertices[1].x = rectVertices[2].x = 4.0f;
+    rectVertices[2].y = rectVertices[3].y = 2.0f;
+
+    std::vector<geometry::Vector2> output;
+    for (unsigned seed = 0; seed < 20; seed++)
+    {
+        std::vector<geometry::Vector2> star = makeRandomStar(50, 0.0f, 0.0f, seed);
+        clipper.clip(star.data(), star.size(), rect, output);
+        EXPECT_NEAR(area(output), compute(clipper, geometry::BooleanOperation::Intersection, star, rectVertices), 1e-3);
+    }
+}
+
+TEST(ClipperTests, ReusesTheOutputBuffer)
+{
+    geometry::Clipper clipper;
+    geometry::Rect rect(1.0f, 1.0f, 4.0f, 4.0f);
+    std::vector<geometry::Vector2> square = makeSquare(0.0f, 0.0f, 2.0f);
+
+    std::vector<geometry::Vector2> output;
+    clipper.clip(square.data(), square.size(), rect, output);
+    const geometry::Vector2* data = output.data();
+    clipper.clip(square.data(), square.size(), rect, output);
+    EXPECT_EQ(output.data(), data);
+}
+
+TEST(ClipperTests, CombinesOverlappingSquares)
+{
+    geometry::Clipper clipper;
+    std::vector<geometry::Vector2> first = makeSquare(0.0f, 0.0f, 2.0f);
+    std::vector<geometry::Vector2> second = makeSquare(1.0f, 1.0f, 2.0f);
+
+    geometry::Contours output;
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Union, first.data(), first.size(), second.data(), second.size(), output), 1u);
+    EXPECT_EQ(output.contourSize(0), 8u);
+    EXPECT_NEAR(output.area(), 7.0, 1e-6);
+
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Intersection, first.data(), first.size(), second.data(), second.size(), output), 1u);
+    EXPECT_EQ(output.contourSize(0), 4u);
+    EXPECT_NEAR(output.area(), 1.0, 1e-6);
+
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Difference, first.data(), first.size(), second.data(), second.size(), output), 1u);
+    EXPECT_EQ(output.contourSize(0), 6u);
+    EXPECT_NEAR(output.area(), 3.0, 1e-6);
+}
+
+TEST(ClipperTests, HandlesSharedEdges)
+{
+    geometry::Clipper clipper;
+    std::vector<geometry::Vector2> left = makeSquare(0.0f, 0.0f, 2.0f);
+    std::vector<geometry::Vector2> right = makeSquare(2.0f, 0.0f, 2.0f);
+    std::vector<geometry::Vector2> inner = makeSquare(0.0f, 0.0f, 1.0f);
+
+    geometry::Contours output;
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Union, left.data(), left.size(), right.data(), right.size(), output), 1u);
+    EXPECT_EQ(output.contourSize(0), 4u);
+    EXPECT_NEAR(output.area(), 8.0, 1e-6);
+
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Intersection, left.data(), left.size(), right.data(), right.size(), output), 0u);
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Difference, left.data(), left.size(), right.data(), right.size(), output), 1u);
+    EXPECT_NEAR(output.area(), 4.0, 1e-6);
+
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Intersection, left.data(), left.size(), inner.data(), inner.size(), output), 1u);
+    EXPECT_NEAR(output.area(), 1.0, 1e-6);
+    EXPECT_EQ(clipper.compute(geometry::BooleanOperation::Difference, left.data(), left.size(), inner.data(), inner.size(), output), 1u);
+    EXPECT_EQ(output.contourSize(0), 6u);
+    EXPECT_NEAR(output.area(), 3.0, 1e-6);
+}
+
+TEST(ClipperTests, CutsAClockwiseHole)
+{
+    geometry::Clipper clipper;
+    geometry::Polygon outer(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(0.0f, 4.0f), geometry::Vector2(4.0f, 4.0f), geometry::Vector2(4.0f, 0.0f));
+    geometry::Polygon hole(geometry::Vector2(1.0f, 1.0f), geometry::Vector2(3.0f, 1.0f), geometry::Vector2(3.0f, 3.0f), geometry::Vector2(1.0f, 3.0f));
+
+    geometry::Contours output;
+    ASSERT_EQ(clipper.compute(geometry::BooleanOperation::Difference, outer, hole, output), 2u);
+    EXPECT_NEAR(output.area(), 12.0, 1e-6);
+
+    const double firstArea = area({output.contourData(0), output.contourData(0) + output.contourSize(0)});
+    const double secondArea = area({output.contourData(1), output.contourData(1) + output.contourSize(1)});
+    EXPECT_NEAR(firstArea + secondArea, 20.0, 1e-6);
+}
+
+TEST(ClipperTests, RandomStarsSatisfyInclusionExclusion)
+{
+    geometry::Clipper clipper;
+    for (unsigned seed = 0; seed < 30; seed++)
+    {
+        std::vector<geometry::Vector2> first = makeRandomStar(40 + seed, 0.0f, 0.0f, seed);
+        std::vector<geometry::Vector2> second = makeRandomStar(60, 3.0f, 1.0f, seed + 100);
+
+        const double united = compute(clipper, geometry::BooleanOperation::Union, first, second);
+        const double intersection = compute(clipper, geometry::BooleanOperation::Intersection, first, second);
+        const double difference = compute(clipper, geometry::BooleanOperation::Difference, first, second);
+
+        EXPECT_GT(intersection, 0.0);
+        EXPECT_NEAR(united + intersection, area(first) + area(second), 1e-3);
+        EXPECT_NEAR(difference, area(first) - intersection, 1e-3);
+    }
+}
+
+TEST(ClipperTests, LargeRandomStarsSatisfyInclusionExclusion)
+{
+    // Thousands of long, nearly parallel spikes cross each other close to their vertices and to each other
+    geometry::Clipper clipper;
+    for (unsigned seed = 0; seed < 2; seed++)
+    {
+        std::vector<geometry::Vector2> first = makeRandomStar(4000, 0.0f, 0.0f, seed);
+        std::vector<geometry::Vector2> second = makeRandomStar(4000, 1.0f, 0.0f, seed + 100);
+
+        const double united = compute(clipper, geometry::BooleanOperation::Union, first, second);
+        const double intersection = compute(clipper, geometry::BooleanOperation::Intersection, first, second);
+        const double difference = compute(clipper, geometry::BooleanOperation::Difference, first, second);
+
+        EXPECT_NEAR(united + intersection, area(first) + area(second), 1e-3);
+        EXPECT_NEAR(difference, area(first) - intersection, 1e-3);
+    }
+}
@@ -0,0 +1,121 @@
+#include "geometry/CollisionChecker.hpp"
+#include "geometry/Circle.hpp"
+#include "geometry/Gjk.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace {
+    std::vector<geometry::Rect> makeRects(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> position(0.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.5f, 8.0f);
+
+        std::vector<geometry::Rect> rects;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            rects.emplace_back(position(generator), position(generator), size(generator), size(generator));
+        }
+        return rects;
+    }
+}
+
+TEST(CollisionCheckerTests, QueryMatchesScalarOverlaps)
+{
+    auto rects = makeRects(517, 1);
+    geometry::RectArray array(rects);
+    geometry::Rect query(40.0f, 40.0f, 15.0f, 10.0f);
+
+    std::vector<std::uint32_t> hits;
+    geometry::CollisionChecker::queryOverlaps(query, array, hits);
+
+    std::vector<std::uint32_t> expected;
+    for (std::uint32_t i = 0; i < rects.size(); i++)
+    {
+        if (query.overlaps(rects[i]))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(hits, expected);
+}
+
+TEST(CollisionCheckerTests, AllPairsMatchesScalarOverlaps)
+{
+    auto rects = makeRects(203, 2);
+    geometry::RectArray array(rects);
+
+    std::vector<geometry::IndexPair> pairs;
+    geometry::CollisionChecker::findOverlappingPairs(array, pairs);
+
+    std::vector<geometry::IndexPair> expected;
+    for (std::uint32_t i = 0; i < rects.size(); i++)
+    {
+        for (std::uint32_t j = i + 1; j < rects.size(); j++)
+        {
+            if (rects[i].overlaps(rects[j]))
+            {
+                expected.push_back({i, j});
+            }
+        }
+    }
+
+    ASSERT_EQ(pairs, expected);
+}
+
+TEST(CollisionCheckerTests, TouchingRectsOverlap)
+{
+    geometry::RectArray array(std::vector<geometry::Rect>{ {0.0f, 0.0f, 1.0f, 1.0f}, {1.0f, 0.0f, 1.0f, 1.0f}, {3.0f, 3.0f, 1.0f, 1.0f} });
+
+    std::vector<geometry::IndexPair> pairs;
+    ASSERT_EQ(geometry::CollisionChecker::findOverlappingPairs(array, pairs), 1u);
+    ASSERT_EQ(pairs[0], (geometry::IndexPair{0, 1}));
+}
+
+TEST(CollisionCheckerTests, ParallelNarrowphaseMatchesSerial)
+{
+    auto rects = makeRects(1500, 5);
+    geometry::RectArray array(rects);
+
+    std::vector<geometry::IndexPair> candidates;
+    geometry::CollisionChecker::findOverlappingPairs(array, candidates);
+
+    // Circles inscribed in the rects, so only some of the candidate pairs really touch.
+    std::vector<geometry::Circle> circles;
+    for (const auto& rect : rects)
+    {
+        circles.emplace_back(rect.center(), std::fmin(rect.getWidth(), rect.getHeight()) / 2);
+    }
+    std::vector<const geometry::Shape*> shapes;
+    for (const auto& circle : circles)
+    {
+        shapes.push_back(&circle);
+    }
+
+    std::vector<geometry::IndexPair> expected;
+    for (const auto& pair : candidates)
+    {
+        if (geometry::Gjk::intersects(circles[pair.first], circles[pair.second]))
+        {
+            expected.push_back(pair);
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+    ASSERT_LT(expected.size(), candidates.size());
+
+    geometry::ThreadPool pool(4);
+    std::vector<geometry::Contact> contacts;
+    geometry::CollisionChecker::checkAllParallel(shapes, candidates, contacts, pool, true, 16);
+
+    ASSERT_EQ(contacts.size(), expected.size());
+    for (std::size_t i = 0; i < contacts.size(); i++)
+    {
+        ASSERT_EQ(contacts[i].pair, expected[i]);
+    }
+
+    geometry::CollisionChecker::checkAllParallel(shapes, candidates, contacts, pool, false, 16);
+    ASSERT_EQ(contacts.size(), expected.size());
+}
@@ -0,0 +1,71 @@
+#include "geometry/ConvexHull.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace {
+    double cross(const geometry::Vector2& origin, const geometry::Vector2& first, const geometry::Vector2& second)
+    {
+        return (static_cast<double>(first.x) - origin.x) * (static_cast<double>(second.y) - origin.y)
+            - (static_cast<double>(first.y) - origin.y) * (static_cast<double>(second.x) - origin.x);
+    }
+
+    std::vector<geometry::Vector2> makeDisk(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::normal_distribution<float> coordinate(0.0f, 50.0f);
+
+        std::vector<geometry::Vector2> points;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            points.emplace_back(coordinate(generator), coordinate(generator));
+        }
+        return points;
+    }
+
+    void expectHullOf(const std::vector<geometry::Vector2>& hull, const std::vector<geometry::Vector2>& points)
+    {
+        ASSERT_GE(hull.size(), 3u);
+        for (std::size_t i = 0; i < hull.size(); i++)
+        {
+            const auto& start = hull[i];
+            const auto& end = hull[(i + 1) % hull.size()];
+
+            // Strictly convex and counter-clockwise.
+            ASSERT_GT(cross(start, end, hull[(i + 2) % hull.size()]), 0.0);
+            for (const auto& point : points)
+            {
+                ASSERT_GE(cross(start, end, point), -1e-3);
+            }
+        }
+    }
+}
+
+TEST(ConvexHullTests, SquareWithInteriorAndEdgePoints)
+{
+    std::vector<geometry::Vector2> points = {{1.0f, 1.0f}, {0.0f, 0.0f}, {2.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 2.0f}, {0.0f, 2.0f}, {0.5f, 1.5f}, {0.0f, 0.0f}};
+
+    std::vector<geometry::Vector2> hull;
+    ASSERT_EQ(geometry::ConvexHull::compute(points, hull), 4u);
+    ASSERT_EQ(hull, (std::vector<geometry::Vector2>{{0.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 2.0f}, {0.0f, 2.0f}}));
+}
+
+TEST(ConvexHullTests, RandomCloud)
+{
+    auto points = makeDisk(5000, 2);
+
+    std::vector<geometry::Vector2> hull;
+    geometry::ConvexHull::compute(points, hull);
+    expectHullOf(hull, points);
+}
+
+TEST(ConvexHullTests, ParallelMatchesSerial)
+{
+    auto points = makeDisk(geometry::ConvexHull::PARALLEL_THRESHOLD + 1000, 8);
+
+    geometry::ThreadPool pool(4);
+    std::vector<geometry::Vector2> serial, parallel;
+    geometry::ConvexHull::compute(points, serial);
+    geometry::ConvexHull::compute(points, parallel, &pool);
+
+    ASSERT_EQ(parallel, serial);
+}
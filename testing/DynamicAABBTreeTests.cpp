@@ -0,0 +1,143 @@
+#include "geometry/DynamicAABBTree.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+    void sortPairs(std::vector<geometry::IndexPair>& pairs)
+    {
+        std::sort(pairs.begin(), pairs.end(), [](const geometry::IndexPair& a, const geometry::IndexPair& b) {
+            return (a.first != b.first) ? a.first < b.first : a.second < b.second;
+        });
+    }
+
+    std::vector<geometry::IndexPair> bruteForcePairs(const std::vector<geometry::Rect>& rects, const std::vector<bool>& alive)
+    {
+        std::vector<geometry::IndexPair> pairs;
+        for (std::uint32_t i = 0; i < rects.size(); i++)
+        {
+            for (std::uint32_t j = i + 1; j < rects.size(); j++)
+            {
+                if (alive[i] && alive[j] && rects[i].overlaps(rects[j]))
+                {
+                    pairs.push_back({i, j});
+                }
+            }
+        }
+        return pairs;
+    }
+}
+
+TEST(DynamicAABBTreeTests, PairsStayExactWhileObjectsMove)
+{
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> smallSize(0.2f, 2.0f);
+    std::uniform_real_distribution<float> step(-0.3f, 0.3f);
+
+    std::vector<geometry::Rect> rects;
+    for (int i = 0; i < 400; i++)
+    {
+        // Very uneven sizes, the case a uniform grid handles badly.
+        float scale = (i % 50 == 0) ? 40.0f : 1.0f;
+        rects.emplace_back(position(generator), position(generator), scale * smallSize(generator), scale * smallSize(generator));
+    }
+    std::vector<bool> alive(rects.size(), true);
+
+    geometry::DynamicAABBTree tree(0.5f);
+    std::vector<geometry::DynamicAABBTree::ProxyId> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); i++)
+    {
+        proxies.push_back(tree.insert(rects[i], i));
+    }
+    ASSERT_TRUE(tree.isValid());
+    ASSERT_LE(tree.getHeight(), 2 * static_cast<int>(std::log2(rects.size())) + 2);
+
+    int reinsertions = 0;
+    std::vector<geometry::IndexPair> pairs;
+    for (int frame = 0; frame < 10; frame++)
+    {
+        for (std::uint32_t i = 0; i < rects.size(); i += 3)
+        {
+            if (!alive[i])
+            {
+                continue;
+            }
+            reinsertions += tree.moveWith(proxies[i], rects[i], geometry::Vector2(step(generator), step(generator)));
+        }
+        if (frame == 4)
+        {
+            for (std::uint32_t i = 1; i < rects.size(); i += 7)
+            {
+                tree.remove(proxies[i]);
+                alive[i] = false;
+            }
+        }
+
+        ASSERT_TRUE(tree.isValid());
+        tree.findPairs(pairs);
+        sortPairs(pairs);
+        ASSERT_EQ(pairs, bruteForcePairs(rects, alive));
+    }
+
+    // The fat bounds absorb most of the small movements.
+    ASSERT_LT(reinsertions, 10 * 134 / 2);
+}
+
+TEST(DynamicAABBTreeTests, PointRegionAndRaycastQueries)
+{
+    geometry::DynamicAABBTree tree;
+    tree.insert(geometry::Rect(0.0f, 0.0f, 2.0f, 2.0f), 1);
+    tree.insert(geometry::Rect(5.0f, 0.0f, 2.0f, 2.0f), 2);
+    tree.insert(geometry::Rect(10.0f, -1.0f, 1.0f, 4.0f), 3);
+    auto removed = tree.insert(geometry::Rect(1.0f, 1.0f, 1.0f, 1.0f), 4);
+    tree.remove(removed);
+
+    std::vector<std::uint32_t> hits;
+    tree.queryPoint(geometry::Vector2(1.5f, 1.5f), hits);
+    ASSERT_EQ(hits, (std::vector<std::uint32_t>{1}));
+
+    tree.query(geometry::Rect(1.0f, 1.0f, 5.0f, 5.0f), hits);
+    std::sort(hits.begin(), hits.end());
+    ASSERT_EQ(hits, (std::vector<std::uint32_t>{1, 2}));
+
+    std::vector<geometry::RaycastHit> rayHits;
+    tree.raycast(geometry::Vector2(20.0f, 1.0f), geometry::Vector2(-10.0f, 1.0f), rayHits);
+    ASSERT_EQ(rayHits.size(), 3u);
+    ASSERT_EQ(rayHits[0].userData, 3u);
+    ASSERT_EQ(rayHits[2].userData, 1u);
+    ASSERT_NEAR(rayHits[0].fraction, 9.0f / 30.0f, 1e-5f);
+
+    tree.raycast(geometry::Vector2(0.0f, 5.0f), geometry::Vector2(20.0f, 5.0f), rayHits);
+    ASSERT_TRUE(rayHits.empty());
+    ASSERT_THROW(tree.remove(removed), std::invalid_argument);
+}
+
+TEST(DynamicAABBTreeTests, UpdateRejectsIdsThatAreNotLeaves)
+{
+    geometry::DynamicAABBTree tree;
+    std::vector<geometry::DynamicAABBTree::ProxyId> leaves;
+    for (std::uint32_t i = 0; i < 4; i++)
+    {
+        leaves.push_back(tree.insert(geometry::Rect(3.0f * i, 0.0f, 1.0f, 1.0f), i));
+    }
+    auto removed = tree.insert(geometry::Rect(0.0f, 5.0f, 1.0f, 1.0f), 4);
+    tree.remove(removed);
+
+    const geometry::Rect bounds(0.0f, 0.0f, 2.0f, 2.0f);
+    ASSERT_THROW(tree.update(removed, bounds), std::invalid_argument);
+    ASSERT_THROW(tree.update(-1, bounds), std::invalid_argument);
+    ASSERT_THROW(tree.update(1000, bounds), std::invalid_argument);
+
+    // Every other id of the pool is an inner node or a free one
+    for (geometry::DynamicAABBTree::ProxyId id = 0; id < 16; id++)
+    {
+        if (std::find(leaves.begin(), leaves.end(), id) == leaves.end())
+        {
+            ASSERT_THROW(tree.update(id, bounds), std::invalid_argument);
+        }
+    }
+    ASSERT_NO_THROW(tree.update(leaves[0], bounds));
+    ASSERT_EQ(tree.size(), 4u);
+}
@@ -0,0 +1,44 @@
+#include "geometry/Fixed.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+
+TEST(FixedTests, ArithmeticIsExact)
+{
+    constexpr geometry::Fixed half = geometry::Fixed(1) / geometry::Fixed(2);
+    static_assert(half.getRaw() == geometry::Fixed::ONE / 2, "1 / 2 should be exactly representable");
+
+    geometry::Fixed a(3.25), b(-1.5);
+    ASSERT_DOUBLE_EQ(static_cast<double>(a + b), 1.75);
+    ASSERT_DOUBLE_EQ(static_cast<double>(a * b), -4.875);
+    ASSERT_DOUBLE_EQ(static_cast<double>(a / b), -2.1666717529296875);
+    ASSERT_THROW(a / geometry::Fixed(0), std::domain_error);
+}
+
+TEST(FixedTests, SqrtAndHypot)
+{
+    ASSERT_EQ(geometry::sqrt(geometry::Fixed(16)), geometry::Fixed(4));
+    ASSERT_NEAR(static_cast<double>(geometry::sqrt(geometry::Fixed(2))), std::sqrt(2.0), 1e-4);
+
+    // 300 * 300 overflows a Q16.16 multiplication, hypot must not.
+    ASSERT_EQ(geometry::hypot(geometry::Fixed(300), geometry::Fixed(400)), geometry::Fixed(500));
+    ASSERT_THROW(geometry::sqrt(geometry::Fixed(-1)), std::domain_error);
+}
+
+TEST(FixedTests, TrigonometryMatchesLibm)
+{
+    for (double angle = -7.0; angle <= 7.0; angle += 0.37)
+    {
+        geometry::Fixed fixedAngle(angle);
+        double exactAngle = static_cast<double>(fixedAngle);
+
+        ASSERT_NEAR(static_cast<double>(geometry::sin(fixedAngle)), std::sin(exactAngle), 1e-4);
+        ASSERT_NEAR(static_cast<double>(geometry::cos(fixedAngle)), std::cos(exactAngle), 1e-4);
+    }
+
+    for (double x = -1.0; x <= 1.0; x += 0.125)
+    {
+        ASSERT_NEAR(static_cast<double>(geometry::acos(geometry::Fixed(x))), std::acos(x), 1e-3);
+        ASSERT_NEAR(static_cast<double>(geometry::atan2(geometry::Fixed(x), geometry::Fixed(-0.5))), std::atan2(x, -0.5), 1e-4);
+    }
+}
@@ -0,0 +1,97 @@
+#include "geometry/Gjk.hpp"
+#include "geometry/Affine2.hpp"
+#include "geometry/Circle.hpp"
+#include "geometry/SeparatingAxis.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    geometry::Polygon makeBox(geometry::Vector2 center, float halfSize, float angle)
+    {
+        geometry::Polygon box({-halfSize, -halfSize}, {halfSize, -halfSize}, {halfSize, halfSize}, geometry::Vector2(-halfSize, halfSize));
+        box.transform(geometry::Affine2::rotation(angle).translate(center));
+        return box;
+    }
+}
+
+TEST(GjkTests, DistanceBetweenRects)
+{
+    geometry::Rect first(0.0f, 0.0f, 2.0f, 2.0f);
+    geometry::Rect second(5.0f, 1.0f, 2.0f, 2.0f);
+
+    geometry::GjkDistance result;
+    ASSERT_FALSE(geometry::Gjk::distance(first, second, result));
+    ASSERT_NEAR(result.distance, 3.0f, 1e-5f);
+    ASSERT_NEAR(result.pointOnFirst.x, 2.0f, 1e-5f);
+    ASSERT_NEAR(result.pointOnSecond.x, 5.0f, 1e-5f);
+}
+
+TEST(GjkTests, DistanceBetweenCircleAndTriangle)
+{
+    geometry::Circle circle({0.0f, 5.0f}, 1.5f);
+    geometry::Triangle triangle({-2.0f, 0.0f}, {2.0f, 0.0f}, {0.0f, 2.0f});
+
+    geometry::GjkDistance result;
+    ASSERT_FALSE(geometry::Gjk::distance(circle, triangle, result));
+    ASSERT_NEAR(result.distance, 1.5f, 1e-3f);
+    ASSERT_NEAR(result.pointOnSecond.y, 2.0f, 1e-3f);
+}
+
+TEST(GjkTests, IntersectionAgreesWithSeparatingAxis)
+{
+    std::mt19937 generator(4);
+    std::uniform_real_distribution<float> position(0.0f, 10.0f);
+    std::uniform_real_distribution<float> size(0.5f, 3.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 3.0f);
+
+    for (int i = 0; i < 400; i++)
+    {
+        geometry::Polygon first = makeBox({position(generator), position(generator)}, size(generator), angle(generator));
+        geometry::Rect second(position(generator), position(generator), size(generator), size(generator));
+
+        geometry::Vector2 expected, translation;
+        bool colliding = geometry::SeparatingAxis::collide(first, second, expected);
+        ASSERT_EQ(geometry::Gjk::intersects(first, second), colliding);
+        ASSERT_EQ(geometry::Gjk::penetration(first, second, translation), colliding);
+        if (colliding)
+        {
+            ASSERT_NEAR(translation.lenght(), expected.lenght(), 1e-3f);
+        }
+    }
+}
+
+TEST(GjkTests, PenetrationOfCircles)
+{
+    geometry::Circle first({0.0f, 0.0f}, 2.0f);
+    geometry::Circle second({3.0f, 0.0f}, 1.5f);
+
+    geometry::Vector2 translation;
+    ASSERT_TRUE(geometry::Gjk::penetration(first, second, translation));
+    ASSERT_NEAR(translation.x, -0.5f, 1e-2f);
+    ASSERT_NEAR(translation.y, 0.0f, 1e-2f);
+}
+
+TEST(GjkTests, WarmStartNeedsFewerIterations)
+{
+    geometry::Polygon first = makeBox({0.0f, 0.0f}, 1.0f, 0.3f);
+    geometry::Circle second({4.0f, 1.0f}, 1.0f);
+
+    geometry::GjkSimplex simplex;
+    geometry::GjkDistance cold, warm;
+    geometry::Gjk::distance(first, second, cold, &simplex);
+
+    second.moveWith({0.01f, 0.02f});
+    geometry::Gjk::distance(first, second, warm, &simplex);
+    ASSERT_LT(warm.iterations, cold.iterations);
+
+    geometry::GjkDistance reference;
+    geometry::Gjk::distance(first, second, reference);
+    ASSERT_NEAR(warm.distance, reference.distance, 1e-4f);
+}
+
+TEST(GjkTests, CircleRejectsNegativeRadius)
+{
+    ASSERT_THROW(geometry::Circle({0.0f, 0.0f}, -1.0f), std::invalid_argument);
+}
@@ -0,0 +1,117 @@
+#include "geometry/Polygon.hpp"
+#include "geometry/Affine2.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <utility>
+
+TEST(PolygonTests, AreaAndPerimeterOfASquare)
+{
+    geometry::Polygon square({0.0f, 0.0f}, {3.0f, 0.0f}, {3.0f, 3.0f}, geometry::Vector2(0.0f, 3.0f));
+
+    ASSERT_DOUBLE_EQ(square.area(), 9.0);
+    ASSERT_DOUBLE_EQ(square.perimeter(), 12.0);
+}
+
+TEST(PolygonTests, CenterIsTheCentroidOfTheArea)
+{
+    // An L shape built vertex by vertex, the vertex average would be (1.5, 1.5).
+    geometry::Polygon shape({0.0f, 0.0f}, {4.0f, 0.0f}, {4.0f, 1.0f});
+    shape.addVertex({1.0f, 1.0f}).addVertex({1.0f, 4.0f}).addVertex({0.0f, 4.0f});
+
+    ASSERT_DOUBLE_EQ(shape.area(), 7.0);
+    ASSERT_DOUBLE_EQ(shape.perimeter(), 16.0);
+    ASSERT_NEAR(shape.center().x, 9.5f / 7.0f, 1e-6f);
+    ASSERT_NEAR(shape.center().y, 9.5f / 7.0f, 1e-6f);
+
+    geometry::Rect bounds = shape.bounds();
+    ASSERT_TRUE(bounds == geometry::Rect(0.0f, 0.0f, 4.0f, 4.0f));
+}
+
+TEST(PolygonTests, RunningSumsMatchARescan)
+{
+    geometry::Polygon circle({10.0f, 0.0f}, {9.9f, 1.4f}, {9.6f, 2.8f});
+    for (int i = 3; i < 2000; i++)
+    {
+        const float angle = 2.0f * 3.14159265f * i / 2000;
+        circle.addVertex({10.0f * std::cos(angle), 10.0f * std::sin(angle)});
+    }
+    circle.moveWith({3.0f, -2.0f});
+    circle.moveTo({1.0f, 1.0f});
+
+    geometry::Polygon rescanned(circle);
+    rescanned.transform(geometry::Affine2::identity());
+
+    ASSERT_NEAR(circle.area(), rescanned.area(), 1e-6 * rescanned.area());
+    ASSERT_NEAR(circle.perimeter(), rescanned.perimeter(), 1e-3);
+    ASSERT_NEAR(circle.center().x, 1.0f, 1e-4f);
+    ASSERT_NEAR(circle.center().y, 1.0f, 1e-4f);
+    ASSERT_NEAR(circle.bounds().getPosition().x, rescanned.bounds().getPosition().x, 1e-5f);
+    ASSERT_NEAR(circle.bounds().getWidth(), rescanned.bounds().getWidth(), 1e-5f);
+}
+
+TEST(PolygonTests, PutVerticesInOrderKeepsTheHull)
+{
+    geometry::Polygon polygon({2.0f, 2.0f}, {0.0f, 0.0f}, {1.0f, 1.0f});
+    polygon.addVertex({0.0f, 2.0f}).addVertex({2.0f, 0.0f});
+    polygon.putVerticesInOrder();
+
+    ASSERT_EQ(std::vector<geometry::Vector2>(polygon.getVertices().begin(), polygon.getVertices().end()), (std::vector<geometry::Vector2>{{0.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 2.0f}, {0.0f, 2.0f}}));
+    ASSERT_DOUBLE_EQ(polygon.area(), 4.0);
+
+    geometry::Polygon line({0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f});
+    ASSERT_THROW(line.putVerticesInOrder(), std::runtime_error);
+}
+
+TEST(PolygonTests, SmallPolygonsKeepTheirVerticesInline)
+{
+    geometry::Polygon quad({0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, geometry::Vector2(0.0f, 1.0f));
+    ASSERT_TRUE(quad.getVertices().isInline());
+    ASSERT_TRUE(quad.getEdgeNormals().isInline());
+
+    geometry::Polygon copy(quad);
+    geometry::Polygon moved(std::move(copy));
+    ASSERT_TRUE(moved.getVertices().isInline());
+    ASSERT_EQ(moved.getVertices(), quad.getVertices());
+    ASSERT_DOUBLE_EQ(moved.area(), 1.0);
+}
+
+TEST(PolygonTests, MovingALargePolygonStealsItsVertices)
+{
+    geometry::Polygon large({0.0f, 0.0f}, {10.0f, 0.0f}, {10.0f, 1.0f});
+    for (int i = 9; i >= 0; i--)
+    {
+        large.addVertex({static_cast<float>(i), 1.0f + (i % 2)});
+    }
+    ASSERT_FALSE(large.getVertices().isInline());
+
+    const geometry::Vector2* storage = large.getVertices().data();
+    geometry::Polygon moved({0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f});
+    moved = std::move(large);
+
+    ASSERT_EQ(moved.getVertices().data(), storage);
+    ASSERT_EQ(moved.getVertices().size(), 13u);
+
+    geometry::Polygon copy({0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f});
+    copy = moved;
+    ASSERT_EQ(copy.getVertices(), moved.getVertices());
+    ASSERT_NE(copy.getVertices().data(), storage);
+    ASSERT_DOUBLE_EQ(copy.perimeter(), moved.perimeter());
+}
+
+TEST(PolygonTests, MovedFromPolygonRejectsNewVertices)
+{
+    geometry::Polygon source({0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f});
+    geometry::Polygon target(std::move(source));
+
+    ASSERT_TRUE(source.getVertices().empty());
+    ASSERT_DOUBLE_EQ(source.area(), 0.0);
+    ASSERT_THROW(source.addVertex({2.0f, 2.0f}), std::runtime_error);
+
+    // Assigning to it makes it usable again
+    source = target;
+    source.addVertex({-1.0f, 0.5f});
+    ASSERT_EQ(source.getVertices().size(), 4u);
+
+    target = std::move(source);
+    ASSERT_THROW(source.addVertex({2.0f, 2.0f}), std::runtime_error);
+}
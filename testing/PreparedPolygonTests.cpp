@@ -0,0 +1,119 @@
+#include "geometry/PreparedPolygon.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace {
+    geometry::Polygon makeStar(int spikes)
+    {
+        auto vertexAt = [spikes](int i) {
+            const float angle = 3.14159265f * i / spikes;
+            const float radius = (i % 2 == 0) ? 10.0f : 4.0f;
+            return geometry::Vector2(radius * std::cos(angle), radius * std::sin(angle));
+        };
+
+        geometry::Polygon star(vertexAt(0), vertexAt(1), vertexAt(2));
+        for (int i = 3; i < 2 * spikes; i++)
+        {
+            star.addVertex(vertexAt(i));
+        }
+        return star;
+    }
+
+    bool bruteForceContains(const geometry::Polygon& polygon, const geometry::Vector2& point)
+    {
+        const auto& vertices = polygon.getVertices();
+        bool inside = false;
+        for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+        {
+            const geometry::Vector2& a = vertices[i];
+            const geometry::Vector2& b = vertices[j];
+            if ((a.y > point.y) != (b.y > point.y) && point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+            {
+                inside = !inside;
+            }
+        }
+        return inside;
+    }
+}
+
+TEST(PreparedPolygonTests, MatchesTheCrossingTestOnAStar)
+{
+    geometry::Polygon star = makeStar(200);
+    geometry::PreparedPolygon prepared(star);
+    ASSERT_GT(prepared.getCellCount(), 1u);
+
+    std::mt19937 generator(6);
+    std::uniform_real_distribution<float> coordinate(-11.0f, 11.0f);
+    std::vector<geometry::Vector2> points;
+    for (int i = 0; i < 50000; i++)
+    {
+        points.emplace_back(coordinate(generator), coordinate(generator));
+    }
+
+    std::vector<std::uint8_t> results;
+    std::size_t inside = prepared.contains(points, results);
+
+    std::size_t expectedInside = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        const bool expected = bruteForceContains(star, points[i]);
+        expectedInside += expected;
+        ASSERT_EQ(results[i] == 1, expected) << "point " << i;
+    }
+    ASSERT_EQ(inside, expectedInside);
+
+    geometry::ThreadPool pool(4);
+    std::vector<std::uint8_t> parallelResults;
+    ASSERT_EQ(prepared.contains(points, parallelResults, &pool), expectedInside);
+    ASSERT_EQ(parallelResults, results);
+}
+
+TEST(PreparedPolygonTests, SharedEdgesBelongToOneSide)
+{
+    geometry::PreparedPolygon left(geometry::Polygon({0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, geometry::Vector2(0.0f, 1.0f)));
+    geometry::PreparedPolygon right(geometry::Polygon({1.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 1.0f}, geometry::Vector2(1.0f, 1.0f)));
+
+    const geometry::Vector2 onSharedEdge(1.0f, 0.5f);
+    ASSERT_NE(left.contains(onSharedEdge), right.contains(onSharedEdge));
+    ASSERT_TRUE(left.contains({0.5f, 0.5f}));
+    ASSERT_FALSE(left.contains({1.5f, 0.5f}));
+}
+
+TEST(PreparedPolygonTests, PointsOnEdgesVerticesAndCellLinesFollowTheCrossingRule)
+{
+    // A zigzag with horizontal, vertical and diagonal edges, queried on a lattice that hits every vertex,
+    // runs along every edge and falls on the lines between the cells
+    geometry::Polygon zigzag({0.0f, 0.0f}, {12.0f, 0.0f}, {12.0f, 6.0f});
+    for (int i = 11; i >= 0; i--)
+    {
+        zigzag.addVertex({static_cast<float>(i), (i % 2 == 0) ? 6.0f : 3.0f});
+    }
+    zigzag.addVertex({0.0f, 3.0f});
+    zigzag.addVertex({2.0f, 2.0f});
+    geometry::PreparedPolygon prepared(zigzag);
+    ASSERT_GT(prepared.getCellCount(), 1u);
+
+    for (float x = -1.0f; x <= 13.0f; x += 0.25f)
+    {
+        for (float y = -1.0f; y <= 7.0f; y += 0.25f)
+        {
+            ASSERT_EQ(prepared.contains({x, y}), bruteForceContains(zigzag, {x, y})) << x << ", " << y;
+        }
+    }
+}
+
+TEST(PreparedPolygonTests, LargeStarsKeepLinearMemory)
+{
+    geometry::Polygon star = makeStar(50000);
+    geometry::PreparedPolygon prepared(star);
+    ASSERT_LE(prepared.getEntryCount(), star.getVertices().size() * geometry::PreparedPolygon::MAX_ENTRIES_PER_EDGE);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> coordinate(-11.0f, 11.0f);
+    for (int i = 0; i < 200; i++)
+    {
+        const geometry::Vector2 point(coordinate(generator), coordinate(generator));
+        ASSERT_EQ(prepared.contains(point), bruteForceContains(star, point)) << "point " << i;
+    }
+}
@@ -0,0 +1,86 @@
+#include "geometry/SeparatingAxis.hpp"
+#include "geometry/Affine2.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+TEST(SeparatingAxisTests, RectsGetTheShortestPush)
+{
+    geometry::Rect first(0.0f, 0.0f, 4.0f, 4.0f);
+    geometry::Rect second(3.0f, 1.0f, 4.0f, 4.0f);
+
+    geometry::Vector2 translation;
+    ASSERT_TRUE(geometry::SeparatingAxis::collide(first, second, translation));
+    ASSERT_EQ(translation, geometry::Vector2(-1.0f, 0.0f));
+
+    geometry::Rect far(10.0f, 0.0f, 1.0f, 1.0f);
+    ASSERT_FALSE(geometry::SeparatingAxis::collide(first, far, translation));
+}
+
+TEST(SeparatingAxisTests, AgreesWithRectOverlaps)
+{
+    std::mt19937 generator(9);
+    std::uniform_real_distribution<float> position(0.0f, 20.0f);
+    std::uniform_real_distribution<float> size(0.5f, 6.0f);
+
+    for (int i = 0; i < 500; i++)
+    {
+        geometry::Rect first(position(generator), position(generator), size(generator), size(generator));
+        geometry::Rect second(position(generator), position(generator), size(generator), size(generator));
+
+        geometry::Vector2 translation;
+        ASSERT_EQ(geometry::SeparatingAxis::collide(first, second, translation), first.overlaps(second));
+    }
+}
+
+TEST(SeparatingAxisTests, TranslationSeparatesRotatedPolygons)
+{
+    geometry::Polygon square({-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, geometry::Vector2(-1.0f, 1.0f));
+    geometry::Polygon diamond(square);
+    diamond.transform(geometry::Affine2::rotation(0.7853982f).translate({1.8f, 0.3f}));
+    geometry::Triangle triangle({0.5f, -3.0f}, {2.0f, 0.2f}, {-1.0f, 0.0f});
+
+    geometry::Vector2 translation;
+    ASSERT_TRUE(geometry::SeparatingAxis::collide(square, diamond, translation));
+    square.moveWith(translation * 1.001f);
+    ASSERT_FALSE(geometry::SeparatingAxis::collide(square, diamond, translation));
+
+    ASSERT_TRUE(geometry::SeparatingAxis::collide(triangle, diamond, translation));
+    triangle.moveWith(translation * 1.001f);
+    ASSERT_FALSE(geometry::SeparatingAxis::collide(triangle, diamond, translation));
+}
+
+TEST(SeparatingAxisTests, PolygonKeepsUnitEdgeNormals)
+{
+    geometry::Polygon polygon({0.0f, 0.0f}, {4.0f, 0.0f}, {4.0f, 3.0f});
+    polygon.addVertex({0.0f, 3.0f});
+    polygon.transform(geometry::Affine2::scaling(2.0f, 1.0f));
+
+    const auto& vertices = polygon.getVertices();
+    const auto& normals = polygon.getEdgeNormals();
+    ASSERT_EQ(normals.size(), vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        const geometry::Vector2 edge = vertices[(i + 1) % vertices.size()] - vertices[i];
+        ASSERT_NEAR(normals[i].lenght(), 1.0f, 1e-6f);
+        ASSERT_NEAR(normals[i].dot(edge), 0.0f, 1e-5f);
+    }
+}
+
+TEST(SeparatingAxisTests, CacheKeepsAxesOfSeparatedPairsOnly)
+{
+    geometry::SeparatingAxisCache cache;
+    geometry::Rect first(0.0f, 0.0f, 2.0f, 2.0f);
+    geometry::Rect second(5.0f, 0.0f, 2.0f, 2.0f);
+
+    geometry::Vector2 translation;
+    ASSERT_FALSE(cache.collide({1, 2}, first, second, translation));
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_FALSE(cache.collide({2, 1}, second, first, translation));
+    ASSERT_EQ(cache.size(), 1u);
+
+    second.moveWith({-4.0f, 0.5f});
+    ASSERT_TRUE(cache.collide({1, 2}, first, second, translation));
+    ASSERT_EQ(cache.size(), 0u);
+    ASSERT_EQ(translation, geometry::Vector2(-1.0f, 0.0f));
+}
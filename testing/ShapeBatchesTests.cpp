@@ -0,0 +1,52 @@
+#include "geometry/ShapeBatches.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(ShapeBatchesTests, AnyShapeMatchesVirtualDispatch)
+{
+    std::vector<geometry::AnyShape> shapes = {
+        geometry::Rect(0.0f, 0.0f, 2.0f, 3.0f),
+        geometry::Circle({1.0f, 1.0f}, 2.0f),
+        geometry::Triangle({0.0f, 0.0f}, {4.0f, 0.0f}, {0.0f, 4.0f}),
+        geometry::Polygon({0.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 2.0f}, geometry::Vector2(0.0f, 2.0f)),
+    };
+
+    for (auto& shape : shapes)
+    {
+        const geometry::Shape& virtualShape = std::visit([](const auto& concrete) -> const geometry::Shape& { return concrete; }, shape);
+        ASSERT_DOUBLE_EQ(geometry::area(shape), virtualShape.area());
+        ASSERT_DOUBLE_EQ(geometry::perimeter(shape), virtualShape.perimeter());
+
+        geometry::moveTo(shape, {10.0f, 10.0f});
+        geometry::moveWith(shape, {1.0f, -1.0f});
+        ASSERT_EQ(geometry::center(shape), virtualShape.center());
+    }
+}
+
+TEST(ShapeBatchesTests, BulkOperationsCoverEveryBatch)
+{
+    geometry::ShapeBatches batches;
+    batches.add(geometry::Rect(0.0f, 0.0f, 2.0f, 3.0f));
+    batches.add(geometry::AnyShape(geometry::Triangle({0.0f, 0.0f}, {4.0f, 0.0f}, {0.0f, 4.0f})));
+    batches.add(geometry::Circle({-5.0f, 0.0f}, 1.0f));
+    batches.add(geometry::Rect(1.0f, 1.0f, 1.0f, 1.0f));
+
+    ASSERT_EQ(batches.size(), 4u);
+    ASSERT_EQ(batches.getBatch<geometry::Rect>().size(), 2u);
+    ASSERT_NEAR(batches.totalArea(), 6.0 + 8.0 + 3.14159265 + 1.0, 1e-5);
+
+    geometry::Rect bounds = batches.totalBounds();
+    ASSERT_TRUE(bounds == geometry::Rect(-6.0f, -1.0f, 10.0f, 5.0f));
+
+    batches.moveWith({1.0f, 2.0f});
+    bounds = batches.totalBounds();
+    ASSERT_TRUE(bounds == geometry::Rect(-5.0f, 1.0f, 10.0f, 5.0f));
+
+    std::size_t visitedBatches = 0;
+    batches.visitBatches([&visitedBatches](const auto&) { visitedBatches++; });
+    ASSERT_EQ(visitedBatches, 4u);
+
+    batches.clear();
+    ASSERT_EQ(batches.size(), 0u);
+    ASSERT_TRUE(batches.totalBounds() == geometry::Rect());
+}
@@ -0,0 +1,122 @@
+#include "geometry/ShapeFile.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    std::string temporaryPath(const std::string& name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    void writeBytes(const std::string& path, const std::string& bytes)
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::string readBytes(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+}
+
+TEST(ShapeFileTests, ReadsBackWhatWasWritten)
+{
+    const std::string path = temporaryPath("ShapeFileTests_roundTrip.geo");
+    geometry::Polygon triangle(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(4.0f, 0.0f), geometry::Vector2(0.0f, 3.0f));
+    std::vector<geometry::Vector2> square = {{1.0f, 1.0f}, {2.0f, 1.0f}, {2.0f, 2.0f}, {1.0f, 2.0f}};
+
+    geometry::ShapeFileWriter writer(path);
+    writer.add(triangle).add(geometry::Rect(1.0f, 2.0f, 3.0f, 4.0f)).addPolygon(square.data(), square.size());
+    EXPECT_EQ(writer.getShapeCount(), 3u);
+    writer.finish();
+    EXPECT_THROW(writer.finish(), std::runtime_error);
+
+    {
+        geometry::MappedShapeFile file(path);
+        ASSERT_EQ(file.size(), 3u);
+        EXPECT_EQ(file.getVertexCount(), 9u);
+        EXPECT_EQ(file.getType(0), geometry::ShapeType::Polygon);
+        EXPECT_EQ(file.getType(1), geometry::ShapeType::Rect);
+
+        geometry::PolygonView first = file.getPolygon(0);
+        ASSERT_EQ(first.size(), 3u);
+        EXPECT_EQ(first[1], geometry::Vector2(4.0f, 0.0f));
+        EXPECT_DOUBLE_EQ(first.area(), triangle.area());
+        EXPECT_DOUBLE_EQ(first.perimeter(), 12.0);
+        EXPECT_EQ(first.toPolygon().getVertices(), triangle.getVertices());
+
+        geometry::RectView rect = file.getRect(1);
+        EXPECT_EQ(rect.getPosition(), geometry::Vector2(1.0f, 2.0f));
+        EXPECT_FLOAT_EQ(rect.getWidth(), 3.0f);
+        EXPECT_FLOAT_EQ(rect.getHeight(), 4.0f);
+        EXPECT_DOUBLE_EQ(rect.area(), 12.0);
+
+        // The views point straight into the mapped vertex block
+        geometry::PolygonView last = file.getPolygon(2);
+        EXPECT_EQ(last.data(), file.getVertexData() + 5);
+        EXPECT_TRUE(std::equal(last.begin(), last.end(), square.begin()));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(last.data()) % alignof(geometry::Vector2), 0u);
+
+        EXPECT_THROW(file.getRect(0), std::invalid_argument);
+        EXPECT_THROW(file.getPolygon(3), std::out_of_range);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(ShapeFileTests, StoresManyShapes)
+{
+    const std::string path = temporaryPath("ShapeFileTests_many.geo");
+    {
+        geometry::ShapeFileWriter writer(path);
+        for (int i = 0; i < 10000; i++)
+        {
+            const float x = static_cast<float>(i);
+            writer.add(geometry::Polygon(geometry::Vector2(x, 0.0f), geometry::Vector2(x + 1.0f, 0.0f), geometry::Vector2(x, 1.0f), geometry::Vector2(x - 1.0f, 0.5f)));
+        }
+        writer.finish();
+    }
+
+    geometry::MappedShapeFile file(path);
+    ASSERT_EQ(file.size(), 10000u);
+    double area = 0.0;
+    for (std::size_t i = 0; i < file.size(); i++)
+    {
+        area += file.getPolygon(i).area();
+    }
+    EXPECT_NEAR(area, 10000.0, 1e-6);
+    EXPECT_EQ(file.getPolygon(9999).bounds().getPosition(), geometry::Vector2(9998.0f, 0.0f));
+    std::remove(path.c_str());
+}
+
+TEST(ShapeFileTests, RejectsInvalidFiles)
+{
+    const std::string path = temporaryPath("ShapeFileTests_invalid.geo");
+    EXPECT_THROW(geometry::MappedShapeFile(temporaryPath("ShapeFileTests_missing.geo")), std::runtime_error);
+
+    writeBytes(path, "not a shape file");
+    EXPECT_THROW(geometry::MappedShapeFile file(path), std::runtime_error);
+
+    {
+        geometry::ShapeFileWriter writer(path);
+        writer.add(geometry::Rect(0.0f, 0.0f, 1.0f, 1.0f));
+        writer.finish();
+    }
+    const std::string valid = readBytes(path);
+    EXPECT_NO_THROW(geometry::MappedShapeFile file(path));
+
+    writeBytes(path, valid.substr(0, valid.size() - 1));
+    EXPECT_THROW(geometry::MappedShapeFile file(path), std::runtime_error);
+
+    std::string otherVersion = valid;
+    otherVersion[offsetof(geometry::ShapeFileHeader, version)] = 2;
+    writeBytes(path, otherVersion);
+    EXPECT_THROW(geometry::MappedShapeFile file(path), std::runtime_error);
+
+    std::remove(path.c_str());
+}
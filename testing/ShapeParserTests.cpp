@@ -0,0 +1,164 @@
+#include "geometry/ShapeParser.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace {
+    struct Collected {
+        std::vector<geometry::Vector2> points;
+        std::vector<geometry::Polygon> polygons;
+        std::size_t batches = 0;
+    };
+
+    Collected parse(geometry::ShapeParser& parser, const std::string& text, geometry::InputFormat format)
+    {
+        Collected collected;
+        std::istringstream input(text);
+        const std::size_t parsed = parser.parse(input, format, [&collected](geometry::ParsedBatch& batch) {
+            collected.points.insert(collected.points.end(), batch.points.begin(), batch.points.end());
+            for (auto& polygon : batch.polygons)
+            {
+                collected.polygons.push_back(std::move(polygon));
+            }
+            collected.batches++;
+        });
+        EXPECT_EQ(parsed, collected.points.size() + collected.polygons.size());
+        return collected;
+    }
+
+    std::string makeCsv(int count)
+    {
+        std::string text = "x,y\n";
+        for (int i = 0; i < count; i++)
+        {
+            text += std::to_string(i) + ".5," + std::to_string(-i) + "\n";
+        }
+        return text;
+    }
+}
+
+TEST(ShapeParserTests, ParsesCsvPoints)
+{
+    geometry::ShapeParser parser;
+    Collected collected = parse(parser, "x,y\r\n1.5, -2\r\n\r\n# a comment\n+3e2,4,ignored\n5,6", geometry::InputFormat::CsvPoints);
+
+    ASSERT_EQ(collected.points.size(), 3u);
+    EXPECT_EQ(collected.points[0], geometry::Vector2(1.5f, -2.0f));
+    EXPECT_EQ(collected.points[1], geometry::Vector2(300.0f, 4.0f));
+    EXPECT_EQ(collected.points[2], geometry::Vector2(5.0f, 6.0f));
+}
+
+TEST(ShapeParserTests, ParsesWkt)
+{
+    geometry::ShapeParser parser;
+    const std::string text =
+        "POINT (1 2)\n"
+        "point(3.5 -4)\n"
+        "POLYGON ((0 0, 4 0, 4 4, 0 4, 0 0), (1 1, 2 1, 2 2, 1 1))\n"
+        "POLYGON EMPTY\n"
+        "\n"
+        "POLYGON((0 0,1 0,0 1))\n";
+    Collected collected = parse(parser, text, geometry::InputFormat::Wkt);
+
+    ASSERT_EQ(collected.points.size(), 2u);
+    EXPECT_EQ(collected.points[1], geometry::Vector2(3.5f, -4.0f));
+    ASSERT_EQ(collected.polygons.size(), 2u);
+    EXPECT_EQ(collected.polygons[0].getVertices().size(), 4u);
+    EXPECT_DOUBLE_EQ(collected.polygons[0].area(), 16.0);
+    EXPECT_EQ(collected.polygons[1].getVertices().size(), 3u);
+}
+
+TEST(ShapeParserTests, ReportsTheLineOfAMalformedRecord)
+{
+    geometry::ShapeParser parser(nullptr, 8);
+    try
+    {
+        parse(parser, "POINT (1 2)\nPOINT (3 4)\nPOINT (5)\n", geometry::InputFormat::Wkt);
+        FAIL();
+    }
+    catch (const std::runtime_error& error)
+    {
+        EXPECT_STREQ(error.what(), "Malformed record on line 3!");
+    }
+
+    EXPECT_THROW(parse(parser, "POLYGON ((0 0, 1 1, 0 0))\n", geometry::InputFormat::Wkt), std::runtime_error);
+    EXPECT_THROW(parse(parser, "1,2\n3;4\n", geometry::InputFormat::CsvPoints), std::runtime_error);
+    EXPECT_THROW(geometry::ShapeParser(nullptr, 0), std::invalid_argument);
+}
+
+TEST(ShapeParserTests, SmallChunksInParallelMatchOneChunk)
+{
+    const std::string text = makeCsv(20000);
+
+    geometry::ShapeParser whole(nullptr, text.size() + 1);
+    Collected expected = parse(whole, text, geometry::InputFormat::CsvPoints);
+    ASSERT_EQ(expected.points.size(), 20000u);
+    EXPECT_EQ(expected.batches, 1u);
+
+    geometry::ThreadPool pool(4);
+    geometry::ShapeParser chunked(&pool, 100);
+    Collected collected = parse(chunked, text, geometry::InputFormat::CsvPoints);
+    EXPECT_GT(collected.batches, 100u);
+    EXPECT_EQ(collected.points, expected.points);
+}
+
+TEST(ShapeParserTests, LinesLongerThanAChunkStayWhole)
+{
+    std::string text;
+    for (int polygon = 0; polygon < 50; polygon++)
+    {
+        text += "POLYGON ((";
+        for (int i = 0; i < 100; i++)
+        {
+            text += std::to_string(polygon) + " " + std::to_string(i) + ", ";
+        }
+        text += "-1 -1))\n";
+    }
+
+    geometry::ThreadPool pool(3);
+    geometry::ShapeParser parser(&pool, 64);
+    Collected collected = parse(parser, text, geometry::InputFormat::Wkt);
+    ASSERT_EQ(collected.polygons.size(), 50u);
+    for (const auto& polygon : collected.polygons)
+    {
+        EXPECT_EQ(polygon.getVertices().size(), 101u);
+    }
+}
+
+TEST(ShapeParserTests, ErrorsStopTheOverlappedParsingCleanly)
+{
+    const std::string text = makeCsv(5000);
+    geometry::ThreadPool pool(4);
+    geometry::ShapeParser parser(&pool, 100);
+
+    // The consumer throws while the pool is parsing the next group
+    std::size_t consumed = 0;
+    std::istringstream input(text);
+    EXPECT_THROW(parser.parse(input, geometry::InputFormat::CsvPoints, [&consumed](geometry::ParsedBatch&) {
+        if (++consumed == 6)
+        {
+            throw std::logic_error("Stop");
+        }
+    }), std::logic_error);
+
+    // A malformed line far into the input is found after the chunks before it were consumed
+    std::string broken = text + "1;2\n" + makeCsv(100).substr(4);
+    std::size_t linesBefore = 0;
+    std::istringstream brokenInput(broken);
+    try
+    {
+        parser.parse(brokenInput, geometry::InputFormat::CsvPoints, [&linesBefore](geometry::ParsedBatch& batch) {
+            linesBefore += batch.points.size();
+        });
+        FAIL();
+    }
+    catch (const std::runtime_error& error)
+    {
+        EXPECT_STREQ(error.what(), "Malformed record on line 5002!");
+    }
+    EXPECT_GT(linesBefore, 0u);
+
+    // The parser is still usable afterwards
+    Collected collected = parse(parser, text, geometry::InputFormat::CsvPoints);
+    EXPECT_EQ(collected.points.size(), 5000u);
+}
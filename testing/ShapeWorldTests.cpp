@@ -0,0 +1,174 @@
+#include "geometry/ShapeWorld.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <stdexcept>
+
+namespace {
+    // Counts the blocks freed by the whole test binary, the tests only look at the difference around a teardown
+    std::atomic<std::size_t> freedBlocks{0};
+
+    void release(void* block)
+    {
+        if (block != nullptr)
+        {
+            freedBlocks++;
+        }
+        std::free(block);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* block = std::malloc(size == 0 ? 1 : size))
+    {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* block = std::aligned_alloc(align, (size + align - 1) / align * align))
+    {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    release(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept
+{
+    release(block);
+}
+
+void operator delete(void* block, std::align_val_t) noexcept
+{
+    release(block);
+}
+
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept
+{
+    release(block);
+}
+
+TEST(ShapeWorldTests, HandlesSurviveOtherDestructions)
+{
+    geometry::ShapeWorld world;
+    auto first = world.create<geometry::Rect>(0.0f, 0.0f, 1.0f, 1.0f);
+    auto second = world.create<geometry::Rect>(5.0f, 5.0f, 2.0f, 3.0f);
+    auto third = world.create<geometry::Rect>(9.0f, 9.0f, 1.0f, 4.0f);
+
+    world.destroy(first);
+    ASSERT_FALSE(world.isAlive(first));
+    ASSERT_EQ(world.get(first), nullptr);
+
+    // The last rect moved into the freed place, its handle still finds it.
+    ASSERT_DOUBLE_EQ(world.get(third)->area(), 4.0);
+    ASSERT_DOUBLE_EQ(world.get(second)->area(), 6.0);
+    ASSERT_EQ(world.getPool<geometry::Rect>().size(), 2u);
+
+    ASSERT_THROW(world.destroy(first), std::invalid_argument);
+}
+
+TEST(ShapeWorldTests, HandlesResolveAgainAfterThePoolGrows)
+{
+    geometry::ShapeWorld world;
+    auto first = world.create<geometry::Circle>(geometry::Vector2(0.0f, 0.0f), 1.0f);
+    const geometry::Circle* before = world.get(first);
+
+    std::vector<geometry::ShapeHandle<geometry::Circle>> circles;
+    for (int i = 0; i < 1000; i++)
+    {
+        circles.push_back(world.create<geometry::Circle>(geometry::Vector2(static_cast<float>(i), 0.0f), 2.0f + i));
+    }
+
+    // The array was reallocated, only the handle still leads to the circle
+    ASSERT_NE(world.get(first), before);
+    ASSERT_FLOAT_EQ(world.get(first)->getRadius(), 1.0f);
+
+    world.destroy(first);
+    ASSERT_FLOAT_EQ(world.get(circles.back())->getRadius(), 1001.0f);
+    ASSERT_FLOAT_EQ(world.get(circles[500])->getRadius(), 502.0f);
+}
+
+TEST(ShapeWorldTests, ReusedSlotsGetANewGeneration)
+{
+    geometry::ShapeWorld world;
+    auto circle = world.create<geometry::Circle>(geometry::Vector2(0.0f, 0.0f), 1.0f);
+    world.destroy(circle);
+
+    auto reused = world.create<geometry::Circle>(geometry::Vector2(1.0f, 1.0f), 2.0f);
+    ASSERT_EQ(reused.index, circle.index);
+    ASSERT_NE(reused, circle);
+    ASSERT_EQ(world.get(circle), nullptr);
+    ASSERT_FLOAT_EQ(world.get(reused)->getRadius(), 2.0f);
+}
+
+TEST(ShapeWorldTests, ResetInvalidatesEveryHandle)
+{
+    geometry::ShapeWorld world;
+    std::vector<geometry::ShapeHandle<geometry::Triangle>> triangles;
+    for (int i = 0; i < 100; i++)
+    {
+        triangles.push_back(world.create<geometry::Triangle>(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(2.0f, 0.0f), geometry::Vector2(0.0f, 2.0f)));
+    }
+    world.create<geometry::Polygon>(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(0.0f, 1.0f));
+    ASSERT_EQ(world.size(), 101u);
+
+    double area = 0.0;
+    world.forEach([&area](const auto& shape) { area += shape.area(); });
+    ASSERT_DOUBLE_EQ(area, 200.5);
+
+    world.reset();
+    ASSERT_EQ(world.size(), 0u);
+    for (const auto& triangle : triangles)
+    {
+        ASSERT_FALSE(world.isAlive(triangle));
+    }
+
+    auto fresh = world.create<geometry::Triangle>(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(0.0f, 1.0f));
+    ASSERT_TRUE(world.isAlive(fresh));
+    ASSERT_FALSE(world.isAlive(triangles[fresh.index]));
+}
+
+TEST(ShapeWorldTests, PoolsOfInlineShapesFreeASingleBlock)
+{
+    auto teardown = [](auto&& fill) {
+        std::optional<geometry::ShapeWorld> world;
+        fill(world.emplace());
+        const std::size_t before = freedBlocks;
+        world.reset();
+        return freedBlocks - before;
+    };
+
+    // Each of the three pools frees its shapes, its slots and the slot of every shape
+    EXPECT_EQ(teardown([](geometry::ShapeWorld& world) {
+        for (int i = 0; i < 1000; i++)
+        {
+            world.create<geometry::Rect>(0.0f, 0.0f, 1.0f, 1.0f);
+            world.create<geometry::Triangle>(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(0.0f, 1.0f));
+            world.create<geometry::Polygon>(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(0.0f, 1.0f));
+        }
+    }), 9u);
+
+    // Polygons past the inline capacity own their vertex and normal buffers
+    EXPECT_EQ(teardown([](geometry::ShapeWorld& world) {
+        for (int i = 0; i < 100; i++)
+        {
+            geometry::Polygon polygon(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(1.0f, 1.0f));
+            for (int j = 0; j < GEOMETRY_POLYGON_INLINE_VERTICES; j++)
+            {
+                polygon.addVertex(geometry::Vector2(-static_cast<float>(j), 1.0f + j));
+            }
+            world.create<geometry::Polygon>(std::move(polygon));
+        }
+    }), 3u + 2u * 100u);
+}
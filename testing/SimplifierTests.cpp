@@ -0,0 +1,182 @@
+#include "geometry/Simplifier.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+    /**
+     * An oversampled, slightly noisy trace.
+     */
+    std::vector<geometry::Vector2> makeTrace(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> noise(-0.01f, 0.01f);
+        std::vector<geometry::Vector2> points;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float x = 0.01f * i;
+            points.emplace_back(x, 5.0f * std::sin(0.1f * x) + noise(generator));
+        }
+        return points;
+    }
+
+    double segmentDistance(const geometry::Vector2& start, const geometry::Vector2& end, const geometry::Vector2& point)
+    {
+        const double dx = end.x - start.x;
+        const double dy = end.y - start.y;
+        const double lenghtSquared = dx * dx + dy * dy;
+        const double t = (lenghtSquared > 0.0) ? std::clamp(((point.x - start.x) * dx + (point.y - start.y) * dy) / lenghtSquared, 0.0, 1.0) : 0.0;
+        return std::hypot(point.x - (start.x + t * dx), point.y - (start.y + t * dy));
+    }
+
+    /**
+     * Checks that the output is a subsequence of the input and that every input point is within
+     * @p tolerance of the output segment spanning it.
+     */
+    void expectWithinTolerance(const std::vector<geometry::Vector2>& input, const std::vector<geometry::Vector2>& output, double tolerance)
+    {
+        ASSERT_GE(output.size(), 2u);
+        EXPECT_EQ(output.front(), input.front());
+        EXPECT_EQ(output.back(), input.back());
+
+        std::size_t segment = 0;
+        for (std::size_t i = 1; i < input.size(); i++)
+        {
+            if (segment + 1 < output.size() && input[i] == output[segment + 1])
+            {
+                segment++;
+                continue;
+            }
+            ASSERT_LT(segment + 1, output.size());
+            EXPECT_LE(segmentDistance(output[segment], output[segment + 1], input[i]), tolerance + 1e-5);
+        }
+        EXPECT_EQ(segment + 1, output.size());
+    }
+}
+
+TEST(SimplifierTests, DouglasPeuckerDropsCollinearPoints)
+{
+    std::vector<geometry::Vector2> line;
+    for (int i = 0; i <= 100; i++)
+    {
+        line.emplace_back(static_cast<float>(i), 2.0f * i);
+    }
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    EXPECT_EQ(simplifier.douglasPeucker(line.data(), line.size(), 1e-4f, output), 2u);
+    EXPECT_EQ(output.front(), line.front());
+    EXPECT_EQ(output.back(), line.back());
+
+    EXPECT_THROW(simplifier.douglasPeucker(line.data(), line.size(), -1.0f, output), std::invalid_argument);
+}
+
+TEST(SimplifierTests, DouglasPeuckerStaysWithinTolerance)
+{
+    std::vector<geometry::Vector2> trace = makeTrace(200000, 1);
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    simplifier.douglasPeucker(trace.data(), trace.size(), 0.05f, output);
+
+    EXPECT_LT(output.size() * 50, trace.size());
+    expectWithinTolerance(trace, output, 0.05);
+}
+
+TEST(SimplifierTests, DouglasPeuckerSimplifiesAPolygon)
+{
+    geometry::Polygon circle(geometry::Vector2(10.0f, 0.0f), geometry::Vector2(std::cos(0.001f) * 10.0f, std::sin(0.001f) * 10.0f),
+        geometry::Vector2(std::cos(0.002f) * 10.0f, std::sin(0.002f) * 10.0f));
+    for (int i = 3; i < 6283; i++)
+    {
+        circle.addVertex(geometry::Vector2(std::cos(0.001f * i) * 10.0f, std::sin(0.001f * i) * 10.0f));
+    }
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    simplifier.douglasPeucker(circle, 0.01f, output);
+
+    EXPECT_GT(output.size(), 8u);
+    EXPECT_LT(output.size(), 200u);
+    EXPECT_EQ(output.front(), circle.getVertices()[0]);
+}
+
+TEST(SimplifierTests, VisvalingamDropsSmallTriangles)
+{
+    std::vector<geometry::Vector2> points = {{0.0f, 0.0f}, {1.0f, 0.01f}, {2.0f, 0.0f}, {3.0f, 2.0f}, {4.0f, 0.0f}, {5.0f, -0.01f}, {6.0f, 0.0f}};
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    EXPECT_EQ(simplifier.visvalingam(points.data(), points.size(), 0.1f, output), 5u);
+    EXPECT_EQ(output, (std::vector<geometry::Vector2>{{0.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 2.0f}, {4.0f, 0.0f}, {6.0f, 0.0f}}));
+
+    EXPECT_EQ(simplifier.visvalingam(points.data(), points.size(), 100.0f, output), 2u);
+    EXPECT_EQ(simplifier.visvalingam(points.data(), points.size(), 0.0f, output), points.size());
+}
+
+TEST(SimplifierTests, VisvalingamReducesANoisyTrace)
+{
+    std::vector<geometry::Vector2> trace = makeTrace(100000, 2);
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    simplifier.visvalingam(trace.data(), trace.size(), 0.01f, output);
+
+    EXPECT_LT(output.size() * 10, trace.size());
+    EXPECT_EQ(output.front(), trace.front());
+    EXPECT_EQ(output.back(), trace.back());
+}
+
+TEST(SimplifierTests, VisvalingamKeepsTheCornersOfAPolygon)
+{
+    geometry::Polygon square(geometry::Vector2(0.0f, 0.0f), geometry::Vector2(1.0f, 0.0f), geometry::Vector2(2.0f, 0.0f),
+        geometry::Vector2(2.0f, 2.0f), geometry::Vector2(1.0f, 2.0f), geometry::Vector2(0.0f, 2.0f), geometry::Vector2(0.0f, 1.0f));
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> output;
+    EXPECT_EQ(simplifier.visvalingam(square, 0.5f, output), 4u);
+    EXPECT_EQ(std::count(output.begin(), output.end(), geometry::Vector2(1.0f, 0.0f)), 0);
+    EXPECT_EQ(std::count(output.begin(), output.end(), geometry::Vector2(2.0f, 2.0f)), 1);
+
+    EXPECT_EQ(simplifier.visvalingam(square, 100.0f, output), 3u);
+}
+
+TEST(SimplifierTests, StreamingStaysWithinToleranceAndWindow)
+{
+    std::vector<geometry::Vector2> trace = makeTrace(100000, 3);
+
+    geometry::StreamingSimplifier streaming(0.05f, 1000);
+    std::vector<geometry::Vector2> output;
+    std::mt19937 generator(4);
+    for (std::size_t begin = 0; begin < trace.size();)
+    {
+        const std::size_t count = std::min<std::size_t>(generator() % 3000, trace.size() - begin);
+        streaming.push(trace.data() + begin, count, output);
+        EXPECT_LT(streaming.getPendingCount(), 1000u);
+        begin += count;
+    }
+    streaming.finish(output);
+    EXPECT_EQ(streaming.getPendingCount(), 0u);
+
+    EXPECT_LT(output.size() * 20, trace.size());
+    expectWithinTolerance(trace, output, 0.05);
+}
+
+TEST(SimplifierTests, StreamingWithAWideWindowMatchesTheBatch)
+{
+    std::vector<geometry::Vector2> trace = makeTrace(5000, 5);
+
+    geometry::StreamingSimplifier streaming(0.05f, trace.size() + 1);
+    std::vector<geometry::Vector2> streamed;
+    streaming.push(trace.data(), 2000, streamed);
+    streaming.push(trace.data() + 2000, trace.size() - 2000, streamed);
+    streaming.finish(streamed);
+
+    geometry::Simplifier simplifier;
+    std::vector<geometry::Vector2> batch;
+    simplifier.douglasPeucker(trace.data(), trace.size(), 0.05f, batch);
+    EXPECT_EQ(streamed, batch);
+
+    EXPECT_THROW(geometry::StreamingSimplifier(0.05f, 2), std::invalid_argument);
+}
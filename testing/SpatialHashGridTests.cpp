@@ -0,0 +1,108 @@
+#include "geometry/SpatialHashGrid.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+namespace {
+    std::vector<geometry::IndexPair> bruteForcePairs(const std::vector<geometry::Rect>& rects)
+    {
+        std::vector<geometry::IndexPair> pairs;
+        for (std::uint32_t i = 0; i < rects.size(); i++)
+        {
+            for (std::uint32_t j = i + 1; j < rects.size(); j++)
+            {
+                if (rects[i].overlaps(rects[j]))
+                {
+                    pairs.push_back({i, j});
+                }
+            }
+        }
+        return pairs;
+    }
+
+    void sortPairs(std::vector<geometry::IndexPair>& pairs)
+    {
+        std::sort(pairs.begin(), pairs.end(), [](const geometry::IndexPair& a, const geometry::IndexPair& b) {
+            return (a.first != b.first) ? a.first < b.first : a.second < b.second;
+        });
+    }
+}
+
+TEST(SpatialHashGridTests, PairsMatchBruteForceWhileMoving)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.5f, 6.0f);
+    std::uniform_real_distribution<float> step(-2.0f, 2.0f);
+
+    std::vector<geometry::Rect> rects;
+    for (int i = 0; i < 300; i++)
+    {
+        rects.emplace_back(position(generator), position(generator), size(generator), size(generator));
+    }
+    // One object much larger than a cell.
+    rects.emplace_back(-10.0f, -10.0f, 40.0f, 25.0f);
+
+    // Few buckets on purpose, so distinct cells collide in the same bucket.
+    geometry::SpatialHashGrid grid(4.0f, 64);
+    std::vector<geometry::SpatialHashGrid::ProxyId> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); i++)
+    {
+        proxies.push_back(grid.insert(rects[i], i));
+    }
+
+    std::vector<geometry::IndexPair> pairs;
+    for (int frame = 0; frame < 5; frame++)
+    {
+        grid.findPairs(pairs);
+        sortPairs(pairs);
+        ASSERT_EQ(pairs, bruteForcePairs(rects));
+
+        for (std::uint32_t i = 0; i < rects.size(); i += 2)
+        {
+            grid.moveWith(proxies[i], rects[i], geometry::Vector2(step(generator), step(generator)));
+        }
+    }
+}
+
+TEST(SpatialHashGridTests, QueryAndRemove)
+{
+    geometry::SpatialHashGrid grid(2.0f);
+    auto first = grid.insert(geometry::Rect(0.0f, 0.0f, 1.0f, 1.0f), 10);
+    grid.insert(geometry::Rect(5.0f, 5.0f, 3.0f, 3.0f), 20);
+    grid.insert(geometry::Rect(-9.0f, 0.0f, 1.0f, 1.0f), 30);
+
+    std::vector<std::uint32_t> hits;
+    grid.query(geometry::Rect(-1.0f, -1.0f, 7.0f, 7.0f), hits);
+    std::sort(hits.begin(), hits.end());
+    ASSERT_EQ(hits, (std::vector<std::uint32_t>{10, 20}));
+
+    grid.remove(first);
+    grid.query(geometry::Rect(-1.0f, -1.0f, 7.0f, 7.0f), hits);
+    ASSERT_EQ(hits, (std::vector<std::uint32_t>{20}));
+    ASSERT_EQ(grid.size(), 2u);
+
+    grid.setCellSize(0.5f);
+    grid.query(geometry::Rect(-100.0f, -100.0f, 200.0f, 200.0f), hits);
+    ASSERT_EQ(hits.size(), 2u);
+    ASSERT_THROW(grid.setCellSize(0.0f), std::invalid_argument);
+}
+
+TEST(SpatialHashGridTests, UpdateRejectsIdsNotInTheGrid)
+{
+    geometry::SpatialHashGrid grid(2.0f);
+    auto kept = grid.insert(geometry::Rect(0.0f, 0.0f, 1.0f, 1.0f), 10);
+    auto removed = grid.insert(geometry::Rect(5.0f, 5.0f, 1.0f, 1.0f), 20);
+    grid.remove(removed);
+
+    const geometry::Rect bounds(1.0f, 1.0f, 1.0f, 1.0f);
+    ASSERT_THROW(grid.update(removed, bounds), std::invalid_argument);
+    ASSERT_THROW(grid.update(1000, bounds), std::invalid_argument);
+    ASSERT_THROW(grid.remove(removed), std::invalid_argument);
+
+    // The removed object must not have come back into any bucket
+    std::vector<std::uint32_t> hits;
+    grid.query(geometry::Rect(-10.0f, -10.0f, 20.0f, 20.0f), hits);
+    ASSERT_EQ(hits, (std::vector<std::uint32_t>{10}));
+    ASSERT_NO_THROW(grid.update(kept, bounds));
+}
@@ -0,0 +1,189 @@
+#include "geometry/SweepAndPrune.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+
+namespace {
+    using PairSet = std::set<std::pair<std::uint32_t, std::uint32_t>>;
+
+    PairSet bruteForcePairs(const std::vector<geometry::Rect>& rects, const std::vector<bool>& alive)
+    {
+        PairSet pairs;
+        for (std::uint32_t i = 0; i < rects.size(); i++)
+        {
+            for (std::uint32_t j = i + 1; j < rects.size(); j++)
+            {
+                if (alive[i] && alive[j] && rects[i].overlaps(rects[j]))
+                {
+                    pairs.insert({i, j});
+                }
+            }
+        }
+        return pairs;
+    }
+
+    PairSet toSet(const std::vector<geometry::IndexPair>& pairs)
+    {
+        PairSet set;
+        for (const auto& pair : pairs)
+        {
+            set.insert({pair.first, pair.second});
+        }
+        return set;
+    }
+}
+
+TEST(SweepAndPruneTests, ReportsOnlyPairChanges)
+{
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> position(0.0f, 60.0f);
+    std::uniform_real_distribution<float> size(0.5f, 5.0f);
+    std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+
+    std::vector<geometry::Rect> rects;
+    for (int i = 0; i < 250; i++)
+    {
+        rects.emplace_back(position(generator), position(generator), size(generator), size(generator));
+    }
+    std::vector<bool> alive(rects.size(), true);
+
+    geometry::SweepAndPrune broadphase;
+    std::vector<geometry::SweepAndPrune::ProxyId> proxies;
+    for (std::uint32_t i = 0; i < rects.size(); i++)
+    {
+        proxies.push_back(broadphase.insert(rects[i], i));
+    }
+
+    PairSet current;
+    std::vector<geometry::IndexPair> added, removed, all;
+    for (int frame = 0; frame < 12; frame++)
+    {
+        broadphase.updatePairs(added, removed);
+
+        PairSet expected = bruteForcePairs(rects, alive);
+        PairSet expectedAdded, expectedRemoved;
+        std::set_difference(expected.begin(), expected.end(), current.begin(), current.end(), std::inserter(expectedAdded, expectedAdded.end()));
+        std::set_difference(current.begin(), current.end(), expected.begin(), expected.end(), std::inserter(expectedRemoved, expectedRemoved.end()));
+
+        ASSERT_EQ(toSet(added), expectedAdded);
+        ASSERT_EQ(toSet(removed), expectedRemoved);
+        ASSERT_EQ(added.size(), expectedAdded.size());
+
+        broadphase.findPairs(all);
+        ASSERT_EQ(toSet(all), expected);
+        current = expected;
+
+        for (std::uint32_t i = frame % 2; i < rects.size(); i += 2)
+        {
+            if (alive[i])
+            {
+                broadphase.moveWith(proxies[i], rects[i], geometry::Vector2(step(generator), step(generator)));
+            }
+        }
+        if (frame == 5)
+        {
+            for (std::uint32_t i = 0; i < rects.size(); i += 9)
+            {
+                broadphase.remove(proxies[i]);
+                alive[i] = false;
+            }
+        }
+        if (frame == 8)
+        {
+            // Reuses the freed ids.
+            for (std::uint32_t i = 0; i < rects.size(); i += 18)
+            {
+                proxies[i] = broadphase.insert(rects[i], i);
+                alive[i] = true;
+            }
+        }
+    }
+}
+
+TEST(SweepAndPruneTests, RemovedObjectDropsItsPairs)
+{
+    geometry::SweepAndPrune broadphase;
+    auto first = broadphase.insert(geometry::Rect(0.0f, 0.0f, 2.0f, 2.0f), 5);
+    broadphase.insert(geometry::Rect(1.0f, 1.0f, 2.0f, 2.0f), 6);
+
+    std::vector<geometry::IndexPair> added, removed;
+    broadphase.updatePairs(added, removed);
+    ASSERT_EQ(added, (std::vector<geometry::IndexPair>{{5, 6}}));
+
+    broadphase.remove(first);
+    broadphase.updatePairs(added, removed);
+    ASSERT_TRUE(added.empty());
+    ASSERT_EQ(removed, (std::vector<geometry::IndexPair>{{5, 6}}));
+    ASSERT_EQ(broadphase.size(), 1u);
+}
+
+TEST(SweepAndPruneTests, UpdateRejectsIdsNotInTheBroadphase)
+{
+    geometry::SweepAndPrune broadphase;
+    auto first = broadphase.insert(geometry::Rect(0.0f, 0.0f, 2.0f, 2.0f), 5);
+    auto second = broadphase.insert(geometry::Rect(1.0f, 1.0f, 2.0f, 2.0f), 6);
+    broadphase.remove(second);
+
+    // Before and after the removal is applied
+    const geometry::Rect bounds(0.5f, 0.5f, 2.0f, 2.0f);
+    ASSERT_THROW(broadphase.update(second, bounds), std::invalid_argument);
+    std::vector<geometry::IndexPair> added, removed;
+    broadphase.updatePairs(added, removed);
+    ASSERT_THROW(broadphase.update(second, bounds), std::invalid_argument);
+    ASSERT_THROW(broadphase.update(1000, bounds), std::invalid_argument);
+
+    ASSERT_NO_THROW(broadphase.update(first, bounds));
+    broadphase.updatePairs(added, removed);
+    ASSERT_TRUE(added.empty());
+    ASSERT_TRUE(removed.empty());
+}
+
+TEST(SweepAndPruneTests, BatchedInsertionsAndRemovals)
+{
+    std::mt19937 generator(8);
+    std::uniform_real_distribution<float> position(0.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.5f, 6.0f);
+
+    std::vector<geometry::Rect> rects;
+    for (int i = 0; i < 600; i++)
+    {
+        rects.emplace_back(position(generator), position(generator), size(generator), size(generator));
+    }
+    std::vector<bool> alive(rects.size(), false);
+
+    geometry::SweepAndPrune broadphase;
+    std::vector<geometry::SweepAndPrune::ProxyId> proxies(rects.size());
+    std::vector<geometry::IndexPair> added, removed, all;
+
+    // Every round adds a batch, removes part of the live objects and moves others, including ones
+    // added and removed between the same two updates
+    for (std::uint32_t round = 0; round < 6; round++)
+    {
+        for (std::uint32_t i = round * 100; i < (round + 1) * 100; i++)
+        {
+            proxies[i] = broadphase.insert(rects[i], i);
+            alive[i] = true;
+        }
+        for (std::uint32_t i = round; i < rects.size(); i += 7)
+        {
+            if (alive[i])
+            {
+                broadphase.remove(proxies[i]);
+                alive[i] = false;
+            }
+        }
+        for (std::uint32_t i = round; i < rects.size(); i += 5)
+        {
+            if (alive[i])
+            {
+                broadphase.moveWith(proxies[i], rects[i], geometry::Vector2(1.5f, -1.0f));
+            }
+        }
+
+        broadphase.updatePairs(added, removed);
+        broadphase.findPairs(all);
+        ASSERT_EQ(toSet(all), bruteForcePairs(rects, alive));
+        ASSERT_EQ(broadphase.size(), static_cast<std::size_t>(std::count(alive.begin(), alive.end(), true)));
+    }
+}
@@ -0,0 +1,45 @@
+#include "geometry/ThreadPool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTests, RunsEveryIndexOnce)
+{
+    geometry::ThreadPool pool(4);
+    ASSERT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> visits(10007);
+    std::atomic<bool> slotsInRange(true);
+    pool.parallelFor(visits.size(), 64, [&](std::size_t begin, std::size_t end, std::size_t slot) {
+        if (slot >= pool.getThreadCount())
+        {
+            slotsInRange = false;
+        }
+        for (std::size_t i = begin; i < end; i++)
+        {
+            visits[i]++;
+        }
+    });
+
+    ASSERT_TRUE(slotsInRange);
+    for (const auto& count : visits)
+    {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTests, RethrowsAfterEveryChunkFinished)
+{
+    geometry::ThreadPool pool(3);
+    std::atomic<int> finished(0);
+
+    ASSERT_THROW(pool.parallelFor(100, 1, [&](std::size_t begin, std::size_t, std::size_t) {
+        finished++;
+        if (begin == 42)
+        {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+    ASSERT_EQ(finished.load(), 100);
+}
@@ -0,0 +1,103 @@
+#include "geometry/TriangleArray.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    std::vector<geometry::Triangle> makeTriangles(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> position(0.0f, 50.0f);
+        std::uniform_real_distribution<float> offset(-6.0f, 6.0f);
+
+        std::vector<geometry::Triangle> triangles;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            geometry::Vector2 anchor(position(generator), position(generator));
+            triangles.emplace_back(anchor, anchor + geometry::Vector2(offset(generator), offset(generator)), anchor + geometry::Vector2(offset(generator), offset(generator)));
+        }
+        return triangles;
+    }
+}
+
+TEST(TriangleTests, ScalarQueries)
+{
+    geometry::Triangle triangle({0.0f, 0.0f}, {4.0f, 0.0f}, {0.0f, 4.0f});
+    ASSERT_DOUBLE_EQ(triangle.area(), 8.0);
+
+    geometry::Barycentric coordinates = triangle.barycentric({1.0f, 2.0f});
+    ASSERT_FLOAT_EQ(coordinates.u, 0.25f);
+    ASSERT_FLOAT_EQ(coordinates.v, 0.25f);
+    ASSERT_FLOAT_EQ(coordinates.w, 0.5f);
+
+    ASSERT_TRUE(triangle.contains({2.0f, 2.0f}));
+    ASSERT_FALSE(triangle.contains({2.1f, 2.1f}));
+
+    ASSERT_TRUE(triangle.overlaps(geometry::Triangle({2.0f, 2.0f}, {5.0f, 5.0f}, {2.0f, 5.0f})));
+    ASSERT_FALSE(triangle.overlaps(geometry::Triangle({3.0f, 3.0f}, {5.0f, 5.0f}, {3.0f, 5.0f})));
+}
+
+TEST(TriangleTests, BatchBarycentricMatchesScalar)
+{
+    auto triangles = makeTriangles(203, 3);
+    geometry::TriangleArray array(triangles);
+
+    std::mt19937 generator(4);
+    std::uniform_real_distribution<float> position(0.0f, 50.0f);
+    geometry::Vector2Array points;
+    for (std::size_t i = 0; i < triangles.size(); i++)
+    {
+        points.push_back({position(generator), position(generator)});
+    }
+
+    std::vector<float> u, v, w;
+    array.barycentric(points, u, v, w);
+    std::vector<std::uint8_t> inside;
+    array.contains(points, inside);
+
+    for (std::size_t i = 0; i < triangles.size(); i++)
+    {
+        geometry::Barycentric expected = triangles[i].barycentric(points.get(i));
+        ASSERT_NEAR(u[i], expected.u, 1e-3f * std::fabs(expected.u) + 1e-4f);
+        ASSERT_NEAR(v[i], expected.v, 1e-3f * std::fabs(expected.v) + 1e-4f);
+        ASSERT_NEAR(w[i], expected.w, 1e-3f * std::fabs(expected.w) + 1e-4f);
+        ASSERT_EQ(inside[i] == 1, triangles[i].contains(points.get(i)));
+    }
+
+    geometry::TriangleArray::barycentric(triangles[0], points, u, v, w);
+    ASSERT_NEAR(v[7], triangles[0].barycentric(points.get(7)).v, 1e-3f);
+
+    geometry::Vector2Array tooShort;
+    ASSERT_THROW(array.contains(tooShort, inside), std::invalid_argument);
+}
+
+TEST(TriangleTests, PickingAndOverlapMatchScalar)
+{
+    auto triangles = makeTriangles(517, 8);
+    geometry::TriangleArray array(triangles);
+
+    const geometry::Vector2 pick(25.0f, 25.0f);
+    const geometry::Triangle probe({20.0f, 20.0f}, {32.0f, 22.0f}, {24.0f, 30.0f});
+
+    std::vector<std::uint32_t> expectedPicks, expectedOverlaps;
+    for (std::uint32_t i = 0; i < triangles.size(); i++)
+    {
+        if (triangles[i].contains(pick))
+        {
+            expectedPicks.push_back(i);
+        }
+        if (triangles[i].overlaps(probe))
+        {
+            expectedOverlaps.push_back(i);
+        }
+    }
+
+    std::vector<std::uint32_t> hits;
+    array.findContaining(pick, hits);
+    ASSERT_EQ(hits, expectedPicks);
+
+    array.findOverlapping(probe, hits);
+    ASSERT_FALSE(expectedOverlaps.empty());
+    ASSERT_EQ(hits, expectedOverlaps);
+}
@@ -0,0 +1,175 @@
+#include "geometry/Triangulator.hpp"
+#include "geometry/PreparedPolygon.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace {
+    geometry::Polygon makePolygon(const std::vector<geometry::Vector2>& vertices)
+    {
+        geometry::Polygon polygon(vertices[0], vertices[1], vertices[2]);
+        for (std::size_t i = 3; i < vertices.size(); i++)
+        {
+            polygon.addVertex(vertices[i]);
+        }
+        return polygon;
+    }
+
+    /**
+     * A star shaped polygon with random radii, which has plenty of split and merge vertices.
+     */
+    geometry::Polygon makeRandomStar(int count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> radius(2.0f, 10.0f);
+        std::vector<geometry::Vector2> vertices;
+        for (int i = 0; i < count; i++)
+        {
+            const float angle = 2.0f * 3.14159265f * i / count;
+            const float r = radius(generator);
+            vertices.emplace_back(r * std::cos(angle), r * std::sin(angle));
+        }
+        return makePolygon(vertices);
+    }
+
+    /**
+     * A comb with teeth pointing up and down, in clockwise order.
+     */
+    geometry::Polygon makeComb(int teeth)
+    {
+        std::vector<geometry::Vector2> vertices;
+        for (int i = 0; i < teeth; i++)
+        {
+            vertices.emplace_back(2.0f * i, 5.0f);
+            vertices.emplace_back(2.0f * i + 1.0f, 5.0f);
+            vertices.emplace_back(2.0f * i + 1.0f, 1.0f);
+        }
+        vertices.emplace_back(2.0f * teeth, 1.0f);
+        for (int i = teeth; i > 0; i--)
+        {
+            vertices.emplace_back(2.0f * i, -4.0f);
+            vertices.emplace_back(2.0f * i - 1.0f, -4.0f);
+            vertices.emplace_back(2.0f * i - 1.0f, 0.0f);
+        }
+        vertices.emplace_back(0.0f, 0.0f);
+        return makePolygon(vertices);
+    }
+
+    /**
+     * Checks that the triangles are counter-clockwise, cover the whole area of the polygon and lie inside it.
+     */
+    void expectValidTriangulation(const geometry::Polygon& polygon, const std::vector<std::uint32_t>& indices)
+    {
+        const auto& vertices = polygon.getVertices();
+        ASSERT_EQ(indices.size(), 3 * (vertices.size() - 2));
+
+        const geometry::PreparedPolygon prepared(polygon);
+
+        double area = 0.0;
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            ASSERT_LT(indices[i], vertices.size());
+            ASSERT_LT(indices[i + 1], vertices.size());
+            ASSERT_LT(indices[i + 2], vertices.size());
+
+            const geometry::Vector2& a = vertices[indices[i]];
+            const geometry::Vector2& b = vertices[indices[i + 1]];
+            const geometry::Vector2& c = vertices[indices[i + 2]];
+            const double doubleArea = (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y)
+                - (static_cast<double>(b.y) - a.y) * (static_cast<double>(c.x) - a.x);
+            EXPECT_GE(doubleArea, 0.0);
+            area += doubleArea / 2.0;
+
+            if (doubleArea > 1e-3)
+            {
+                EXPECT_TRUE(prepared.contains((a + b + c) / 3.0f));
+            }
+        }
+        EXPECT_NEAR(area, polygon.area(), 1e-3 * polygon.area());
+    }
+}
+
+TEST(TriangulatorTests, TriangulatesASquareInBothOrientations)
+{
+    geometry::Polygon counterClockwise = makePolygon({{0.0f, 0.0f}, {2.0f, 0.0f}, {2.0f, 2.0f}, {0.0f, 2.0f}});
+    geometry::Polygon clockwise = makePolygon({{0.0f, 0.0f}, {0.0f, 2.0f}, {2.0f, 2.0f}, {2.0f, 0.0f}});
+
+    std::vector<std::uint32_t> indices;
+    EXPECT_EQ(counterClockwise.triangulate(indices), 2u);
+    expectValidTriangulation(counterClockwise, indices);
+    EXPECT_EQ(clockwise.triangulate(indices), 2u);
+    expectValidTriangulation(clockwise, indices);
+}
+
+TEST(TriangulatorTests, EarClippingHandlesConcaveAndCollinearVertices)
+{
+    geometry::Polygon shape = makePolygon({{0.0f, 0.0f}, {2.0f, 0.0f}, {4.0f, 0.0f}, {4.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, 4.0f}, {0.0f, 4.0f}, {0.0f, 2.0f}});
+
+    std::vector<std::uint32_t> indices;
+    geometry::Triangulator::earClipping(shape.getVertices().data(), shape.getVertices().size(), indices);
+    expectValidTriangulation(shape, indices);
+    geometry::Triangulator::monotonePartition(shape.getVertices().data(), shape.getVertices().size(), indices);
+    expectValidTriangulation(shape, indices);
+}
+
+TEST(TriangulatorTests, BothMethodsHandleACombWithSplitAndMergeVertices)
+{
+    geometry::Polygon comb = makeComb(10);
+    const auto& vertices = comb.getVertices();
+
+    std::vector<std::uint32_t> indices;
+    geometry::Triangulator::earClipping(vertices.data(), vertices.size(), indices);
+    expectValidTriangulation(comb, indices);
+    geometry::Triangulator::monotonePartition(vertices.data(), vertices.size(), indices);
+    expectValidTriangulation(comb, indices);
+}
+
+TEST(TriangulatorTests, BothMethodsHandleRandomStars)
+{
+    for (unsigned seed = 0; seed < 20; seed++)
+    {
+        geometry::Polygon star = makeRandomStar(40 + 20 * seed, seed);
+        const auto& vertices = star.getVertices();
+
+        std::vector<std::uint32_t> indices;
+        geometry::Triangulator::earClipping(vertices.data(), vertices.size(), indices);
+        expectValidTriangulation(star, indices);
+        geometry::Triangulator::monotonePartition(vertices.data(), vertices.size(), indices);
+        expectValidTriangulation(star, indices);
+    }
+}
+
+TEST(TriangulatorTests, TriangulatesALargePolygon)
+{
+    geometry::Polygon star = makeRandomStar(100000, 7);
+
+    std::vector<std::uint32_t> indices;
+    EXPECT_EQ(star.triangulate(indices), 99998u);
+    expectValidTriangulation(star, indices);
+}
+
+TEST(TriangulatorTests, TriangulatesManyPolygonsInParallel)
+{
+    std::vector<geometry::Polygon> polygons;
+    for (unsigned seed = 0; seed < 64; seed++)
+    {
+        polygons.push_back(seed % 2 == 0 ? makeRandomStar(8 + 10 * seed, seed) : makeComb(1 + seed));
+    }
+    std::vector<const geometry::Polygon*> pointers;
+    for (const auto& polygon : polygons)
+    {
+        pointers.push_back(&polygon);
+    }
+
+    geometry::ThreadPool pool(4);
+    std::vector<std::vector<std::uint32_t>> indices;
+    geometry::Triangulator::triangulateAll(pointers, indices, pool);
+
+    ASSERT_EQ(indices.size(), polygons.size());
+    for (std::size_t i = 0; i < polygons.size(); i++)
+    {
+        std::vector<std::uint32_t> expected;
+        polygons[i].triangulate(expected);
+        EXPECT_EQ(indices[i], expected);
+    }
+}
@@ -0,0 +1,85 @@
+#include "geometry/Vector2Array.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+    // An odd size so both the vectorized loop and the scalar tail are exercised.
+    std::vector<geometry::Vector2> makeVectors(std::size_t count)
+    {
+        std::vector<geometry::Vector2> vectors;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            vectors.emplace_back(static_cast<float>(i) - 7.5f, 3.0f * static_cast<float>(i % 5) - 4.0f);
+        }
+        vectors[3] = geometry::Vector2(0.0f, 0.0f);
+        return vectors;
+    }
+}
+
+TEST(Vector2ArrayTests, ConversionRoundTrip)
+{
+    auto vectors = makeVectors(19);
+    geometry::Vector2Array array(vectors);
+
+    ASSERT_EQ(array.size(), vectors.size());
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.xData()) % geometry::internal::simd::ALIGNMENT, 0u);
+
+    auto back = array.toVector();
+    for (std::size_t i = 0; i < vectors.size(); i++)
+    {
+        ASSERT_EQ(back[i], vectors[i]);
+    }
+}
+
+TEST(Vector2ArrayTests, BulkOperationsMatchScalarVector2)
+{
+    auto vectors = makeVectors(23);
+    auto others = makeVectors(23);
+    for (auto& v : others)
+    {
+        v.rotateBy(0.3f);
+    }
+
+    geometry::Vector2Array array(vectors);
+    geometry::Vector2Array otherArray(others);
+
+    array.add(otherArray).scaleBy(0.5f).rotateBy(1.1f).subtract(geometry::Vector2(1.0f, 2.0f)).lerp(otherArray, 0.25f).normalize();
+
+    std::vector<float> dots, lenghts;
+    array.dot(otherArray, dots);
+    array.lenght(lenghts);
+
+    for (std::size_t i = 0; i < vectors.size(); i++)
+    {
+        geometry::Vector2 expected = vectors[i];
+        expected.add(others[i]).scaleBy(0.5f).rotateBy(1.1f).subtract(geometry::Vector2(1.0f, 2.0f));
+        expected += (others[i] - expected) * 0.25f;
+        expected.normalize();
+
+        ASSERT_NEAR(array.get(i).x, expected.x, 1e-5f);
+        ASSERT_NEAR(array.get(i).y, expected.y, 1e-5f);
+        ASSERT_NEAR(dots[i], expected.dot(others[i]), 1e-4f);
+        ASSERT_NEAR(lenghts[i], expected.lenght(), 1e-5f);
+    }
+}
+
+TEST(Vector2ArrayTests, NormalizeKeepsNullVectors)
+{
+    geometry::Vector2Array array(std::vector<geometry::Vector2>(9));
+    array.set(8, geometry::Vector2(3.0f, 4.0f));
+    array.normalize();
+
+    ASSERT_FLOAT_EQ(array.get(0).x, 0.0f);
+    ASSERT_FLOAT_EQ(array.get(0).y, 0.0f);
+    ASSERT_FLOAT_EQ(array.get(8).x, 0.6f);
+}
+
+TEST(Vector2ArrayTests, SizeMismatchThrows)
+{
+    geometry::Vector2Array a(4), b(5);
+
+    ASSERT_THROW(a.add(b), std::invalid_argument);
+    ASSERT_THROW(a.lerp(b, 0.5f), std::invalid_argument);
+}
@@ -1,6 +1,9 @@
 #include "geometry/Vector2.hpp"
+#include "geometry/CachedVector2.hpp"
 #include <gtest/gtest.h>
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 #ifndef M_PI_2
 #define M_PI_2 1.5707963267948966192313216916398f
@@ -80,6 +83,58 @@ TEST(Vector2Tests, AngleBetweenNullVect)
     ASSERT_ANY_THROW(randomvect.angleBetween(nullvect));
 }
 
+TEST(Vector2Tests, CompactTriviallyCopyableLayout)
+{
+    static_assert(sizeof(geometry::Vector2) == 8, "Vector2 should be two packed floats");
+    static_assert(std::is_trivially_copyable<geometry::Vector2>::value, "Vector2 should be memcpy-able");
+
+    constexpr geometry::Vector2 v = geometry::Vector2(1.0f, 2.0f) + geometry::Vector2(3.0f, 4.0f) * 2.0f;
+    static_assert(v.x == 7.0f && v.y == 10.0f, "Vector2 arithmetic should be usable in constant expressions");
+
+    geometry::Vector2 buffer[2] = { {1.0f, 2.0f}, {3.0f, 4.0f} };
+    geometry::Vector2 copy[2];
+    std::memcpy(copy, buffer, sizeof(buffer));
+
+    ASSERT_EQ(copy[1], geometry::Vector2(3.0f, 4.0f));
+    ASSERT_NE(copy[0], geometry::Vector2(2.0f, 2.0f));
+}
+
+TEST(Vector2Tests, CachedVectorInvalidatesOnChange)
+{
+    geometry::CachedVector2 v(3.0f, 4.0f);
+
+    ASSERT_FLOAT_EQ(v.lenght(), 5.0f);
+    ASSERT_FLOAT_EQ(v.cosTheta(), 0.6f);
+
+    v.scaleBy(2.0f);
+    ASSERT_FLOAT_EQ(v.lenght(), 10.0f);
+
+    v.normalize();
+    ASSERT_FLOAT_EQ(v.lenght(), 1.0f);
+    ASSERT_FLOAT_EQ(v.sinTheta(), 0.8f);
+    ASSERT_FLOAT_EQ(v.vector().x, 0.6f);
+
+    geometry::CachedVector2 nullvect;
+    ASSERT_THROW(nullvect.precompute(), std::runtime_error);
+}
+
+TEST(Vector2Tests, DoubleAndFixedInstantiations)
+{
+    geometry::Vector2d precise(1.0e-9, 0.0);
+    ASSERT_FALSE(precise.isNull());
+    ASSERT_DOUBLE_EQ(precise.normalized().x, 1.0);
+
+    geometry::Vector2fx a(geometry::Fixed(3), geometry::Fixed(4));
+    ASSERT_EQ(a.lenght(), geometry::Fixed(5));
+    ASSERT_EQ(a.normalized().x, geometry::Fixed(0.6));
+
+    // The same rotation gives bit-identical results every time, the tolerance only covers the CORDIC error.
+    geometry::Vector2fx rotated = geometry::Vector2fx(geometry::Fixed(1), geometry::Fixed(0)).rotatedBy(geometry::Fixed(M_PI_2));
+    ASSERT_NEAR(static_cast<double>(rotated.x), 0.0, 1e-4);
+    ASSERT_NEAR(static_cast<double>(rotated.y), 1.0, 1e-4);
+    ASSERT_NEAR(static_cast<double>(a.angleBetween(rotated)), std::acos(0.8), 1e-3);
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);